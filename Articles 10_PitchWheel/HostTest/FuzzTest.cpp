@@ -0,0 +1,279 @@
+/*
+     _____.___.  _____  ________    ______  ____________
+     \__  |   | /     \ \_____  \  /  __  \/_   \_____  \
+      /   |   |/  \ /  \  _(__  <  >      < |   |/  ____/
+      \____   /    Y    \/       \/   --   \|   /       \
+      / ______\____|__  /______  /\______  /|___\_______ \
+      \/              \/       \/        \/             \/
+            ________ __________.____    ________
+            \_____  \\______   \    |   \_____  \
+             /   |   \|     ___/    |    /  ____/
+            /    |    \    |   |    |___/       \
+            \_______  /____|   |_______ \_______ \
+                    \/                 \/       \/
+
+
+YM3182 OPL2 LIBRARY source code designed to run on the AVR128DA28.
+Copyright (C) 2022 Tyler Klein
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program. If not, see <https://www.gnu.org/licenses/>.
+
+Description:
+Fuzz test. Arbitrary bytes go into the MIDI input, through MidiParser and the sketch's handlers into the YM3812
+class, and every register write that comes out is checked as it happens. It builds two ways: with clang's
+libFuzzer (make fuzz), which looks for inputs that reach new code, or with any compiler as a program of its own
+that makes up random input or replays saved inputs (make fuzz-run). Both run under the address and undefined
+behavior sanitizers, so memory errors and things like overflowing shifts get caught along with the checks here.
+
+  FuzzTest [-runs=N] [-seed=N] [-max_len=N] [input ...]
+
+INPUT:
+The input is a list of records. The first byte of a record says how many MIDI bytes follow (low 5 bits, plus
+one) and how long to run loop() and the control tick afterwards (top 3 bits, see FUZZ_WAITS). The MIDI bytes
+can be anything at all, running status, SysEx and real time bytes included. Once the input runs out, All Notes
+Off goes to every channel and the sketch gets a little time to finish up.
+
+CHECKS:
+  - Every write goes to a register the OPL2 has, and the channel it belongs to is one the chip has.
+  - A copy of the chip's registers kept from the writes (as they would be after the reset in setup) agrees with
+    the class's register caches (YM3812::getRegister) after each record. The class skips writes the caches
+    say aren't needed, so a cache that's wrong means a note that sounds wrong.
+  - No more voices are playing than there are channels.
+  - After All Notes Off, nothing is playing and no channel has its key on bit set.
+The sketch only gets set up once, so each input starts from wherever the last one left it, which is what the
+module sees when it has been playing for a while. A failure prints what went wrong, and the standalone build
+also saves the input as fuzz-fail.bin. Replaying that (FuzzTest fuzz-fail.bin) starts from a fresh setup, so if
+the failure needed what came before it, run the same -seed again instead.
+
+*/
+
+#include "HostTest.h"
+#include <stdarg.h>
+#include <stdlib.h>
+#include "YM3812.h"
+#ifdef __SANITIZE_ADDRESS__
+  #include <sanitizer/common_interface_defs.h>
+#endif
+
+#define FUZZ_NOTES_OFF_MS  20                                                  // Time to run after All Notes Off before checking for stuck notes
+
+static const uint16_t FUZZ_WAITS[8] = { 0, 1, 2, 5, 10, 20, 50, 200 };         // Milliseconds to run after a record (top 3 bits of its first byte)
+
+extern YM3812 PROC_YM3812;                                                     // The sketch's instance
+
+static uint8_t        chip[256];                                               // The registers as the writes left them
+static unsigned long  writes = 0;                                              // Writes checked so far
+static const uint8_t *input = NULL;                                            // The input being run, saved if it fails
+static size_t         input_len = 0;
+
+
+/*******************************************
+ * Checks                                  *
+ *******************************************/
+
+static void saveInput(){                                                       // Keep the input that failed (libFuzzer does this itself)
+  #ifndef FUZZ_LIBFUZZER
+    FILE *f = fopen( "fuzz-fail.bin", "wb" );
+    if( f ){ fwrite( input, 1, input_len, f ); fclose( f ); printf( "input saved to fuzz-fail.bin\n" ); }
+    fflush( stdout );
+  #endif
+}
+
+static void fuzzFail( const char *format, ... ){                               // Report a broken invariant and stop
+  va_list args;
+  va_start( args, format );
+  printf( "FUZZ FAIL at %lu us, write %lu: ", host_us, writes );
+  vprintf( format, args );
+  printf( "\n" );
+  va_end( args );
+  saveInput();
+  abort();
+}
+
+static int regChannel( uint8_t reg ){                                          // The channel a register belongs to (-1 = global, -2 = no such register)
+  switch( reg ){
+    case 0x01: case 0x02: case 0x03: case 0x04: case 0x08: case 0xBD: return( -1 );
+  }
+  if( reg >= 0xA0 && reg < 0xD0 ){                                             // Channel registers: A0, B0 and C0 + channel
+    if( (reg & 0x0F) > 8 ) return( -2 );
+    return( reg & 0x0F );
+  }
+  uint8_t group = reg & 0xE0, offset = reg & 0x1F;
+  if( group == 0x00 || group == 0xC0 ) return( -2 );
+  if( offset >= 0x16 || (offset & 7) >= 6 ) return( -2 );                      // Operator registers: 3 channels x 2 operators every 8 addresses
+  return( (offset >> 3) * 3 + (offset & 7) % 3 );
+}
+
+static void busCheck( uint8_t reg, uint8_t val ){                              // Every write the sketch makes (see ymBusTrace)
+  writes++;
+  int ch = regChannel( reg );
+  if( ch == -2 ) fuzzFail( "write to %02X, which isn't an OPL2 register", reg );
+  if( ch >= YM3812_NUM_CHANNELS ) fuzzFail( "write to %02X, for channel %d of %d", reg, ch, YM3812_NUM_CHANNELS );
+  chip[reg] = val;
+}
+
+static void checkState(){                                                      // Compare the class with what went out on the bus
+  for( int reg = 0; reg < 256; reg++ ){
+    int16_t cached = PROC_YM3812.getRegister( reg );
+    if( cached >= 0 && cached != chip[reg] ) fuzzFail( "register %02X holds %02X, but the class has %02X cached", reg, chip[reg], cached );
+  }
+  if( PROC_YM3812.getActiveVoices() > YM3812_NUM_CHANNELS ) fuzzFail( "%u voices playing", PROC_YM3812.getActiveVoices() );
+}
+
+static void checkSilent(){                                                     // After All Notes Off
+  if( PROC_YM3812.getActiveVoices() ) fuzzFail( "%u voices still playing after All Notes Off", PROC_YM3812.getActiveVoices() );
+  for( uint8_t ch = 0; ch < YM3812_NUM_CHANNELS; ch++ ){
+    if( chip[0xB0 + ch] & 0x20 ) fuzzFail( "channel %u still keyed on after All Notes Off", ch );
+  }
+}
+
+
+/*******************************************
+ * Fuzz Target                             *
+ *******************************************/
+
+extern "C" int LLVMFuzzerTestOneInput( const uint8_t *data, size_t len ){
+  static bool started = false;
+  if( !started ){
+    started = true;
+    bus_check = busCheck;
+    setup();                                                                   // The chip was just reset, so chip[] starts out all zero
+    hostRun( 10 );
+    checkState();
+  }
+  input = data;
+  input_len = len;
+
+  size_t pos = 0;
+  while( pos < len ){                                                          // One record at a time (see INPUT)
+    uint8_t head = data[pos++];
+    size_t  count = (head & 0x1F) + 1;
+    if( count > len - pos ) count = len - pos;
+    hostMidi( data + pos, count );
+    pos += count;
+    hostRun( FUZZ_WAITS[head >> 5] );
+    checkState();
+  }
+
+  for( uint8_t ch = 0; ch < 16; ch++ ){                                        // All Notes Off everywhere (which also ends any SysEx left open)
+    const uint8_t notes_off[3] = { (uint8_t)(0xB0 | ch), 123, 0 };
+    hostMidi( notes_off, 3 );
+  }
+  hostRun( FUZZ_NOTES_OFF_MS );
+  checkState();
+  checkSilent();
+  return( 0 );
+}
+
+
+/*******************************************
+ * Standalone                              *
+ *******************************************/
+// Without libFuzzer, make up inputs from a seeded random number generator, or replay the files given. Plain
+// noise hardly ever gets as far as a patch edit, so the random inputs are mostly whole messages the sketch
+// handles (notes, its controllers, NRPN patch edits, SysEx for this module) with some noise mixed in, cut up into
+// records at random. Messages can run across records, since the MIDI input doesn't know where records start.
+
+#ifndef FUZZ_LIBFUZZER
+
+static uint32_t rng = 1;
+static uint32_t random32(){ rng ^= rng << 13; rng ^= rng >> 17; rng ^= rng << 5; return( rng ); } // xorshift32
+static uint8_t  random7(){ return( random32() & 0x7F ); }
+
+static const uint8_t FUZZ_CCS[] = { 1, 5, 6, 7, 9, 11, 14, 15, 20, 21, 38, 65, 76, 77, 78, 98, 99, 100, 101, 120, 123, 126, 127 };
+
+static size_t randomMessage( uint8_t *msg ){                                   // One message into msg (up to 16 bytes), returns its length
+  uint8_t ch = random32() % 16;
+  switch( random32() % 12 ){
+    case 0: case 1: case 2:
+      msg[0] = 0x90 | ch; msg[1] = 36 + random32() % 48; msg[2] = random7();   // Note on (velocity 0 is a note off)
+      return( 3 );
+    case 3: case 4:
+      msg[0] = 0x80 | ch; msg[1] = 36 + random32() % 48; msg[2] = random7();
+      return( 3 );
+    case 5: case 6:
+      msg[0] = 0xB0 | ch; msg[1] = FUZZ_CCS[ random32() % sizeof(FUZZ_CCS) ]; msg[2] = random7();
+      return( 3 );
+    case 7:                                                                    // Patch field edit
+      msg[0] = 0xB0 | ch; msg[1] = 99; msg[2] = 0; msg[3] = 98; msg[4] = random32() % (PATCH_SIZE); msg[5] = 6; msg[6] = random7();
+      return( 7 );
+    case 8:
+      msg[0] = 0xE0 | ch; msg[1] = random7(); msg[2] = random7();
+      return( 3 );
+    case 9:
+      msg[0] = 0xC0 | ch; msg[1] = random7();
+      return( 2 );
+    case 10: {                                                                 // SysEx for this module, usually cut short
+      size_t len = 3 + random32() % 12;
+      msg[0] = 0xF0; msg[1] = 0x7D; msg[2] = 1 + random32() % 7;
+      for( size_t i = 3; i < len; i++ ) msg[i] = random32() % 4 ? random32() % 16 : random7();
+      msg[len++] = 0xF7;
+      return( len );
+    }
+    default: {                                                                 // Noise
+      size_t len = 1 + random32() % 4;
+      for( size_t i = 0; i < len; i++ ) msg[i] = random32();
+      return( len );
+    }
+  }
+}
+
+static size_t randomInput( uint8_t *data, size_t max_len ){
+  static uint8_t stream[ 1 << 16 ];
+  size_t len = random32() % (max_len + 1), count = 0;
+  if( len > sizeof(stream) - 16 ) len = sizeof(stream) - 16;
+  while( count < len ) count += randomMessage( stream + count );               // Enough messages to fill the input
+  size_t pos = 0, used = 0;
+  while( pos < len ){                                                          // Cut it up into records
+    uint8_t head = random32();
+    data[pos++] = head;
+    for( uint8_t i = 0; i <= (head & 0x1F) && pos < len; i++ ) data[pos++] = stream[used++];
+  }
+  return( len );
+}
+
+int main( int argc, char **argv ){
+  unsigned long runs = 1000, seed = 1, max_len = 256, inputs = 0, bytes = 0;
+  int files = 0;
+  #ifdef __SANITIZE_ADDRESS__
+    __sanitizer_set_death_callback( saveInput );                               // So a sanitizer error keeps the input too
+  #endif
+  for( int i = 1; i < argc; i++ ){
+    if( sscanf( argv[i], "-runs=%lu", &runs ) == 1 ) continue;
+    if( sscanf( argv[i], "-seed=%lu", &seed ) == 1 ) continue;
+    if( sscanf( argv[i], "-max_len=%lu", &max_len ) == 1 ) continue;
+    FILE *f = fopen( argv[i], "rb" );                                          // Anything else is an input to replay
+    if( !f ){ printf( "%s: can't open\n", argv[i] ); return( 1 ); }
+    static uint8_t data[ 1 << 16 ];
+    size_t len = fread( data, 1, sizeof(data), f );
+    fclose( f );
+    LLVMFuzzerTestOneInput( data, len );
+    inputs++; bytes += len; files++;
+  }
+  if( !files ){
+    uint8_t *data = (uint8_t *)malloc( max_len + 1 );
+    rng = seed ? seed : 1;
+    for( unsigned long run = 0; run < runs; run++ ){
+      size_t len = randomInput( data, max_len );
+      LLVMFuzzerTestOneInput( data, len );
+      inputs++; bytes += len;
+    }
+    free( data );
+  }
+  printf( "%lu inputs, %lu bytes, %lu register writes, %.1f s of MIDI, no problems found\n",
+          inputs, bytes, writes, host_us / 1e6 );
+  return( 0 );
+}
+
+#endif  // FUZZ_LIBFUZZER
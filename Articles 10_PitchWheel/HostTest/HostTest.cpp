@@ -0,0 +1,135 @@
+/*
+     _____.___.  _____  ________    ______  ____________
+     \__  |   | /     \ \_____  \  /  __  \/_   \_____  \
+      /   |   |/  \ /  \  _(__  <  >      < |   |/  ____/
+      \____   /    Y    \/       \/   --   \|   /       \
+      / ______\____|__  /______  /\______  /|___\_______ \
+      \/              \/       \/        \/             \/
+            ________ __________.____    ________
+            \_____  \\______   \    |   \_____  \
+             /   |   \|     ___/    |    /  ____/
+            /    |    \    |   |    |___/       \
+            \_______  /____|   |_______ \_______ \
+                    \/                 \/       \/
+
+
+YM3182 OPL2 LIBRARY source code designed to run on the AVR128DA28.
+Copyright (C) 2022 Tyler Klein
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program. If not, see <https://www.gnu.org/licenses/>.
+
+Description:
+Host runtime for the tests: the Arduino globals, the clock and the bus recorder. See HostTest.h for the theory
+of operation.
+
+*/
+
+#include "HostTest.h"
+#include "SPI.h"
+#include "Flash.h"
+#include "EEPROM.h"
+#include "YM3812.h"
+
+
+/*******************************************
+ * Arduino Core                            *
+ *******************************************/
+
+PORT_t         PORTD;
+TCB_t          TCB0, TCB1;
+HardwareSerial Serial, Serial2;
+SPIClass       SPI;
+FlashClass     Flash;
+EEPROMClass    EEPROM;
+NVMCTRL_t      NVMCTRL;
+
+unsigned long host_us = 0;                                                     // The clock
+
+unsigned long millis(){ return( host_us / 1000 ); }
+unsigned long micros(){ return( host_us ); }
+void delay( unsigned long ms ){ host_us += ms * 1000; }
+void delayMicroseconds( unsigned int us ){ host_us += us; }
+
+bool HardwareSerial::feed( uint8_t data ){                                     // A byte arrives from outside
+  uint8_t next = (rx_head + 1) % SERIAL_RX_BUFFER_SIZE;
+  if( next == rx_tail ) return( false );                                       // Buffer full, the byte is lost (like the real one)
+  rx[rx_head] = data;
+  rx_head = next;
+  return( true );
+}
+
+int HardwareSerial::read(){
+  if( rx_head == rx_tail ) return( -1 );
+  uint8_t data = rx[rx_tail];
+  rx_tail = (rx_tail + 1) % SERIAL_RX_BUFFER_SIZE;
+  return( data );
+}
+
+
+/*******************************************
+ * Bus Recorder                            *
+ *******************************************/
+
+std::vector<BusWrite> bus_log;                                                 // Writes recorded so far
+bool                  bus_record = false;                                      // Add writes to bus_log
+void                (*bus_check)( uint8_t reg, uint8_t val ) = NULL;           // Called with every write
+
+void ymBusTrace( uint8_t reg, uint8_t val ){                                   // Every register write comes through here (see YM3812::sendData)
+  if( bus_record ) bus_log.push_back( { (uint32_t)host_us, reg, val } );
+  if( bus_check ) bus_check( reg, val );
+}
+
+
+/*******************************************
+ * Running the Sketch                      *
+ *******************************************/
+
+static unsigned long next_tick = 0;                                            // When the control tick timer fires next
+
+static void hostTick(){                                                        // Fire the timer interrupt for every period that has passed
+  if( !(TCB0.CTRLA & TCB_ENABLE_bm) || !(TCB0.INTCTRL & TCB_CAPT_bm) ) return; // Not started yet
+  unsigned long period = (TCB0.CCMP + 1UL) * 2 * 1000000 / F_CPU;              // TCB0 counts at half the CPU clock
+  if( !next_tick ) next_tick = host_us + period;
+  while( host_us >= next_tick ){
+    TCB0_INT_vect();
+    next_tick += period;
+  }
+}
+
+void hostRun( unsigned long ms ){                                              // Run loop() and the control tick for ms milliseconds
+  unsigned long end = host_us + ms * 1000;
+  while( host_us < end ){
+    hostTick();
+    loop();
+    host_us += HOST_LOOP_US;
+  }
+}
+
+bool hostMidi( const uint8_t *data, size_t len ){                              // Send bytes to the MIDI input and run until they're handled
+  bool ok = true;
+  for( size_t i = 0; i < len; i++ ){
+    if( !Serial2.feed( data[i] ) ){                                            // Full, give the sketch a chance to catch up first
+      hostTick();
+      loop();
+      host_us += HOST_LOOP_US;
+      ok &= Serial2.feed( data[i] );
+    }
+  }
+  while( Serial2.available() ){
+    hostTick();
+    loop();
+    host_us += HOST_LOOP_US;
+  }
+  return( ok );
+}
@@ -0,0 +1,84 @@
+#ifndef HOSTTEST_H
+#define HOSTTEST_H
+
+/*
+     _____.___.  _____  ________    ______  ____________
+     \__  |   | /     \ \_____  \  /  __  \/_   \_____  \
+      /   |   |/  \ /  \  _(__  <  >      < |   |/  ____/
+      \____   /    Y    \/       \/   --   \|   /       \
+      / ______\____|__  /______  /\______  /|___\_______ \
+      \/              \/       \/        \/             \/
+            ________ __________.____    ________
+            \_____  \\______   \    |   \_____  \
+             /   |   \|     ___/    |    /  ____/
+            /    |    \    |   |    |___/       \
+            \_______  /____|   |_______ \_______ \
+                    \/                 \/       \/
+
+
+YM3182 OPL2 LIBRARY source code designed to run on the AVR128DA28.
+Copyright (C) 2022 Tyler Klein
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program. If not, see <https://www.gnu.org/licenses/>.
+
+--- Description: ---
+Runs the YM3812_PitchWheel sketch on a PC, so changes can be checked without the hardware. The sketch and the
+library are built as they are, against small stand-ins for the Arduino core (stubs/), with YM_BUS_TRACE on so
+every register write comes back through ymBusTrace. The tests drive the sketch through its own handlers and
+loop(), and look at what went out on the bus. TraceTest compares that with recorded traces; FuzzTest throws
+random MIDI at it and checks that nothing breaks; SongTest lets it play demo_song and reports the timing.
+
+
+--- Theory of Operation: ---
+TIME:
+The clock (host_us) only moves when something moves it. hostRun moves it HOST_LOOP_US per pass through loop(),
+and delay() and delayMicroseconds() move it by however long the code asked to wait, so a register write costs
+the same 42us it does on the chip. Nothing depends on how fast the PC is, and the same input always gives the
+same writes at the same times.
+
+CONTROL TICK:
+The sketch starts the control tick by setting up TCB0. hostRun works the period out from TCB0.CCMP the same way
+the timer would, and calls the timer interrupt every time a period has passed, so the tick tasks run at the rate
+the sketch asked for, catching up after a long pass just like they do on the hardware.
+
+BUS:
+ymBusTrace adds each write to bus_log with the time it happened, as long as bus_record is set, and also hands it
+to bus_check (if there is one) so a test can look at each write as it happens.
+
+*/
+
+#include "Arduino.h"
+#include <vector>
+
+#define HOST_LOOP_US         100                                                                  // Time (micros) each pass through loop() takes
+
+struct BusWrite {
+  uint32_t      time;                                                                             // micros() when the write started
+  uint8_t       reg;                                                                              // Register address
+  uint8_t       val;                                                                              // Value written
+};
+
+extern unsigned long         host_us;                                                             // The clock (see TIME)
+extern std::vector<BusWrite> bus_log;                                                             // Writes recorded so far
+extern bool                  bus_record;                                                          // Add writes to bus_log
+extern void                (*bus_check)( uint8_t reg, uint8_t val );                              // Called with every write (NULL = nothing)
+
+void setup();                                                                                     // The sketch
+void loop();
+
+void hostRun( unsigned long ms );                                                                 // Run loop() and the control tick for ms milliseconds
+bool hostMidi( const uint8_t *data, size_t len );                                                 // Send bytes to the MIDI input and run until they're handled (false if some got lost)
+
+
+#endif  // HOSTTEST_H
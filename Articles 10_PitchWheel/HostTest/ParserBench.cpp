@@ -0,0 +1,211 @@
+/*
+     _____.___.  _____  ________    ______  ____________
+     \__  |   | /     \ \_____  \  /  __  \/_   \_____  \
+      /   |   |/  \ /  \  _(__  <  >      < |   |/  ____/
+      \____   /    Y    \/       \/   --   \|   /       \
+      / ______\____|__  /______  /\______  /|___\_______ \
+      \/              \/       \/        \/             \/
+            ________ __________.____    ________
+            \_____  \\______   \    |   \_____  \
+             /   |   \|     ___/    |    /  ____/
+            /    |    \    |   |    |___/       \
+            \_______  /____|   |_______ \_______ \
+                    \/                 \/       \/
+
+
+YM3182 OPL2 LIBRARY source code designed to run on the AVR128DA28.
+Copyright (C) 2022 Tyler Klein
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program. If not, see <https://www.gnu.org/licenses/>.
+
+Description:
+MIDI input benchmark. The same stream of MIDI goes through MidiParser and, when it is built in, the MIDI library
+(FortySevenEffects), both reading it out of Serial2 the way the sketch does, and the time each takes per byte
+and per message is printed. Both hand every message to a handler that only counts it, so what gets timed is
+the decoding and the dispatch, not the synth. The counts have to agree, which also checks that MidiParser
+understands the stream the same way the library does.
+
+  make bench                                    MidiParser on its own
+  make bench MIDI_LIB=<arduino_midi_library>/src  and the MIDI library next to it
+
+The times are the PC's, not the AVR's, so only the ratio between the two means anything (the AVR has no cache
+and no branch predictor to flatter either of them). The stream is a mix of what a busy song sends: notes with
+running status and zero velocity note offs, controller and pitch wheel sweeps, program changes, clock bytes
+in between everything, and now and then a Patch SysEx message.
+
+*/
+
+#include "HostTest.h"
+#include "MidiParser.h"
+#include "YMDefs.h"
+#include <chrono>
+#include <algorithm>
+#ifdef MIDI_LIB
+  #include <MIDI.h>
+#endif
+
+#define BENCH_BYTES        (4UL * 1024 * 1024)                                 // Size of the stream
+#define BENCH_RUNS         5                                                   // Best of this many runs
+#define BENCH_FEED         (SERIAL_RX_BUFFER_SIZE - 1)                         // Bytes put in the receive buffer at a time
+
+struct BenchCounts {
+  unsigned long on = 0, off = 0, control = 0, program = 0, bend = 0, sysex = 0;
+  unsigned long total() const { return( on + off + control + program + bend + sysex ); }
+  bool operator==( const BenchCounts &c ) const {
+    return( on == c.on && off == c.off && control == c.control && program == c.program && bend == c.bend && sysex == c.sysex );
+  }
+};
+
+static std::vector<uint8_t> stream;                                            // The MIDI to decode
+static BenchCounts          counts;                                            // Messages seen by the handlers
+
+
+/*******************************************
+ * Stream                                  *
+ *******************************************/
+
+static uint32_t rng = 1;
+static uint8_t random7(){ rng ^= rng << 13; rng ^= rng >> 17; rng ^= rng << 5; return( rng & 0x7F ); } // xorshift32
+
+static void add( uint8_t data ){                                               // Add a byte, with a clock byte every so often
+  stream.push_back( data );
+  if( !(random7() & 0x0F) ) stream.push_back( 0xF8 );
+}
+
+static void buildStream(){
+  uint32_t bar = 0;
+  while( stream.size() < BENCH_BYTES ){
+    uint8_t ch = bar % 16;
+    add( 0x90 | ch );                                                          // A chord, released with zero velocity note ons (running status)
+    for( uint8_t i = 0; i < 4; i++ ){ add( 48 + i * 4 ); add( 1 + random7() % 127 ); }
+    for( uint8_t i = 0; i < 4; i++ ){ add( 48 + i * 4 ); add( 0 ); }
+    add( 0x80 | ch ); add( 60 ); add( 64 );                                    // A proper note off
+    add( 0xE0 | ch );                                                          // Pitch wheel sweep
+    for( uint8_t i = 0; i < 16; i++ ){ add( random7() ); add( 0x38 + i ); }
+    add( 0xB0 | ch );                                                          // Mod wheel and volume
+    for( uint8_t i = 0; i < 8; i++ ){ add( i & 1 ? 7 : 1 ); add( random7() ); }
+    if( bar % 4 == 0 ){ add( 0xC0 | ch ); add( random7() ); }
+    if( bar % 32 == 0 ){                                                       // Patch upload: F0 7D 01 <inst> <patch> <checksum> F7
+      add( 0xF0 ); add( 0x7D ); add( 0x01 ); add( ch );
+      for( uint8_t i = 0; i < PATCH_SIZE + 1; i++ ) add( random7() );
+      add( 0xF7 );
+    }
+    bar++;
+  }
+}
+
+template<class Drain> static double timeRun( Drain drain ){                    // Seconds to push the stream through Serial2 and drain() it
+  auto start = std::chrono::steady_clock::now();
+  for( size_t pos = 0; pos < stream.size(); ){
+    size_t end = std::min( stream.size(), pos + BENCH_FEED );
+    while( pos < end ) Serial2.feed( stream[pos++] );
+    drain();
+  }
+  return( std::chrono::duration<double>( std::chrono::steady_clock::now() - start ).count() );
+}
+
+
+/*******************************************
+ * MidiParser                              *
+ *******************************************/
+
+static MidiParser parser;
+
+static void parserDrain(){
+  MidiEvent event;
+  while( parser.read( event ) ){
+    switch( event.type ){                                                      // Like handleMidiEvent
+      case MIDI_NOTE_ON:    counts.on++;      break;
+      case MIDI_NOTE_OFF:   counts.off++;     break;
+      case MIDI_CONTROL:    counts.control++; break;
+      case MIDI_PROGRAM:    counts.program++; break;
+      case MIDI_PITCH_BEND: counts.bend++;    break;
+      case MIDI_SYSEX:      if( event.data2 & MIDI_SYSEX_END ) counts.sysex++; break;
+    }
+  }
+}
+
+
+/*******************************************
+ * MIDI Library                            *
+ *******************************************/
+
+#ifdef MIDI_LIB
+  MIDI_CREATE_INSTANCE( HardwareSerial, Serial2, MIDI_LIB_IN );                // Set up like the sketch's MIDI_PARSER 0 build
+
+  static void libNoteOn(  byte channel, byte note, byte velocity ){ counts.on++; }
+  static void libNoteOff( byte channel, byte note, byte velocity ){ counts.off++; }
+  static void libControl( byte channel, byte number, byte value ){ counts.control++; }
+  static void libProgram( byte channel, byte number ){ counts.program++; }
+  static void libBend(    byte channel, int bend ){ counts.bend++; }
+  static void libSysEx(   byte *data, unsigned size ){ counts.sysex++; }
+
+  static void libBegin(){
+    MIDI_LIB_IN.setHandleNoteOn( libNoteOn );
+    MIDI_LIB_IN.setHandleNoteOff( libNoteOff );
+    MIDI_LIB_IN.setHandleControlChange( libControl );
+    MIDI_LIB_IN.setHandleProgramChange( libProgram );
+    MIDI_LIB_IN.setHandlePitchBend( libBend );
+    MIDI_LIB_IN.setHandleSystemExclusive( libSysEx );
+    MIDI_LIB_IN.begin( MIDI_CHANNEL_OMNI );
+    MIDI_LIB_IN.turnThruOff();                                                 // Echoing the input isn't part of decoding it
+  }
+
+  static void libDrain(){
+    while( Serial2.available() ) MIDI_LIB_IN.read();
+  }
+#endif
+
+
+/*******************************************
+ * Main                                    *
+ *******************************************/
+
+template<class Drain> static void bench( const char *name, Drain drain, BenchCounts &result ){
+  double best = 1e9;
+  for( int run = 0; run < BENCH_RUNS; run++ ){
+    counts = BenchCounts();
+    best = std::min( best, timeRun( drain ) );
+  }
+  result = counts;
+  printf( "%-14s %9.1f %12lu %12.2f %12.1f\n", name, best * 1000, counts.total(),
+          best * 1e9 / stream.size(), best * 1e9 / counts.total() );
+}
+
+int main(){
+  buildStream();
+  printf( "%zu bytes of MIDI\n\n", stream.size() );
+  printf( "%-14s %9s %12s %12s %12s\n", "", "ms", "messages", "ns/byte", "ns/message" );
+
+  BenchCounts parser_counts;
+  parser.begin( Serial2 );
+  bench( "MidiParser", parserDrain, parser_counts );
+  printf( "  %lu note on, %lu note off, %lu control, %lu program, %lu bend, %lu SysEx\n",
+          parser_counts.on, parser_counts.off, parser_counts.control, parser_counts.program, parser_counts.bend, parser_counts.sysex );
+
+  #ifdef MIDI_LIB
+    BenchCounts lib_counts;
+    libBegin();
+    bench( "MIDI library", libDrain, lib_counts );
+    if( !(lib_counts == parser_counts) ){
+      printf( "  %lu note on, %lu note off, %lu control, %lu program, %lu bend, %lu SysEx\n",
+              lib_counts.on, lib_counts.off, lib_counts.control, lib_counts.program, lib_counts.bend, lib_counts.sysex );
+      printf( "The two don't agree on what the stream holds\n" );
+      return( 1 );
+    }
+  #else
+    printf( "\n(make bench MIDI_LIB=<arduino_midi_library>/src to compare with the MIDI library)\n" );
+  #endif
+  return( 0 );
+}
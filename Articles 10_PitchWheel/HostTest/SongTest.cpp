@@ -0,0 +1,104 @@
+/*
+     _____.___.  _____  ________    ______  ____________
+     \__  |   | /     \ \_____  \  /  __  \/_   \_____  \
+      /   |   |/  \ /  \  _(__  <  >      < |   |/  ____/
+      \____   /    Y    \/       \/   --   \|   /       \
+      / ______\____|__  /______  /\______  /|___\_______ \
+      \/              \/       \/        \/             \/
+            ________ __________.____    ________
+            \_____  \\______   \    |   \_____  \
+             /   |   \|     ___/    |    /  ____/
+            /    |    \    |   |    |___/       \
+            \_______  /____|   |_______ \_______ \
+                    \/                 \/       \/
+
+
+YM3182 OPL2 LIBRARY source code designed to run on the AVR128DA28.
+Copyright (C) 2022 Tyler Klein
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program. If not, see <https://www.gnu.org/licenses/>.
+
+Description:
+Song player test, for a sketch built with SMF_PLAYER on (make song). First a few broken files go through a
+SmfPlayer of its own: a chunk that isn't a track, a track that runs past the end of the file, and an empty
+track. They have to load (or be turned down) and play to the end without reading outside the file, which the
+address sanitizer keeps an eye on. Then the sketch plays demo_song by itself on the host clock, and how late
+the events came out of SmfPlayer::read is reported. Lateness here is what the sketch's own loop and bus writes
+cost on the host clock (HOST_LOOP_US per pass, 42us per write), so it changes when the sketch does more per
+event, not when the PC is busy. The test fails if the worst case goes over SONG_LATE_MAX.
+
+  SongTest
+
+*/
+
+#include "HostTest.h"
+#include "SmfPlayer.h"
+
+#define SONG_RUN_MS        8000                                                // How long the sketch plays demo_song (twice round)
+#define SONG_LATE_MAX      2000                                                // Latest an event can be (microseconds) before the test fails
+
+extern SmfPlayer SONG;                                                         // The sketch's player
+
+static const uint8_t STRAY_CHUNK[] = {                                         // Says 2 tracks, but one of the chunks isn't a track
+  'M','T','h','d', 0,0,0,6, 0,1, 0,2, 0,96,
+  'X','F','I','L', 0,0,0,2, 0x12,0x34,
+  'M','T','r','k', 0,0,0,12, 0x00,0x90,0x3C,0x64, 0x60,0x80,0x3C,0x00, 0x00,0xFF,0x2F,0x00
+};
+
+static const uint8_t SHORT_TRACK[] = {                                         // Track claims more bytes than the file has
+  'M','T','h','d', 0,0,0,6, 0,0, 0,1, 0,96,
+  'M','T','r','k', 0,0,0,100, 0x00,0x90,0x3C,0x64
+};
+
+static const uint8_t EMPTY_TRACK[] = {                                         // Empty track right at the end of the file
+  'M','T','h','d', 0,0,0,6, 0,1, 0,2, 0,96,
+  'M','T','r','k', 0,0,0,12, 0x00,0x90,0x3C,0x64, 0x60,0x80,0x3C,0x00, 0x00,0xFF,0x2F,0x00,
+  'M','T','r','k', 0,0,0,0
+};
+
+static int failed = 0;
+
+static void testFile( const char *name, const uint8_t *smf, uint32_t len, bool loads, uint32_t events ){
+  SmfPlayer player;
+  MidiEvent event;
+  uint32_t  got = 0;
+  bool      ok  = (player.begin( smf, len ) == loads);
+  if( ok && loads ){
+    player.play();
+    for( uint16_t ms = 0; ms < 2000 && player.playing(); ms++ ){               // Plenty of time for a beat
+      host_us += 1000;
+      while( player.read( event ) ) got++;
+    }
+    ok = !player.playing() && got == events;
+  }
+  printf( "%s %-20s %s, %lu events\n", ok ? "PASS    " : "FAIL    ", name, loads ? "loads" : "turned down",
+          (unsigned long)got );
+  if( !ok ) failed++;
+}
+
+int main(){
+  testFile( "stray_chunk", STRAY_CHUNK, sizeof( STRAY_CHUNK ), true, 2 );
+  testFile( "short_track", SHORT_TRACK, sizeof( SHORT_TRACK ), false, 0 );
+  testFile( "empty_track", EMPTY_TRACK, sizeof( EMPTY_TRACK ), true, 2 );
+
+  setup();
+  hostRun( SONG_RUN_MS );
+  uint32_t events = SONG.getEvents();
+  uint32_t late   = SONG.getLateMax();
+  bool     ok     = events > 0 && late <= SONG_LATE_MAX;
+  printf( "%s %-20s %lu events, late max %luus, average %luus\n", ok ? "PASS    " : "FAIL    ", "demo_song",
+          (unsigned long)events, (unsigned long)late, (unsigned long)( events ? SONG.getLateTotal() / events : 0 ) );
+  if( !ok ) failed++;
+  return( failed ? 1 : 0 );
+}
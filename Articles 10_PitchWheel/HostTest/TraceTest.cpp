@@ -0,0 +1,287 @@
+/*
+     _____.___.  _____  ________    ______  ____________
+     \__  |   | /     \ \_____  \  /  __  \/_   \_____  \
+      /   |   |/  \ /  \  _(__  <  >      < |   |/  ____/
+      \____   /    Y    \/       \/   --   \|   /       \
+      / ______\____|__  /______  /\______  /|___\_______ \
+      \/              \/       \/        \/             \/
+            ________ __________.____    ________
+            \_____  \\______   \    |   \_____  \
+             /   |   \|     ___/    |    /  ____/
+            /    |    \    |   |    |___/       \
+            \_______  /____|   |_______ \_______ \
+                    \/                 \/       \/
+
+
+YM3182 OPL2 LIBRARY source code designed to run on the AVR128DA28.
+Copyright (C) 2022 Tyler Klein
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program. If not, see <https://www.gnu.org/licenses/>.
+
+Description:
+Golden register trace tests. Each scenario in scenarios/ is a short script of MIDI messages that gets played
+through the sketch's handlers, and every register write it causes is recorded with the time it happened. The
+recording has to match the golden trace for the scenario (golden/<name>.trace) exactly: the same registers, the
+same values, the same order, at the same times. So a change to chSendPatch, chSetPitch, chGetNext and friends
+that alters what goes to the chip gets noticed, and so does one that only adds writes (the write count is
+printed for every scenario, and compared along with everything else).
+
+  TraceTest [--update] scenario.txt ...
+
+--update records the golden traces again instead of checking them, for when a change is meant to alter the
+writes. Look over the diff of golden/ before committing it.
+
+SCENARIOS:
+One command per line, # starts a comment. Channels are 1 - 16 like the MIDI library.
+  on    <channel> <note> <velocity>     handleNoteOn
+  off   <channel> <note> [velocity]     handleNoteOff
+  bend  <channel> <value>               handlePitchBend (-8192 ... 8191)
+  cc    <channel> <controller> <value>  handleControlChange
+  prog  <channel> <program>             handleProgramChange
+  wait  <milliseconds>                  Run loop() and the control tick
+  midi  <hex bytes ...>                 Raw bytes into the MIDI input (SysEx and friends), run until handled
+The sketch's setup() runs first, and its writes aren't part of the trace. Times are micros from the start of
+the script. Each scenario runs in a process of its own, so they can't affect each other.
+
+DIFF:
+When a trace doesn't match, the writes are lined up against the golden ones (longest common subsequence of the
+register / value pairs, once any common start and end are out of the way) and shown like a unified diff, with
+- for writes that went missing and + for new ones. If the writes all match and only the times moved, it says
+so and shows where the timing first differs instead.
+
+*/
+
+#include "HostTest.h"
+#include <string>
+#include <algorithm>
+#include <stdlib.h>
+#include <unistd.h>
+#include <sys/wait.h>
+
+#define TRACE_CONTEXT      3                                                   // Matching writes shown around each change
+#define TRACE_DIFF_LINES   60                                                  // Most lines of diff shown per scenario
+#define TRACE_DIFF_CELLS   (16UL * 1024 * 1024)                                // Largest table the diff will build (writes x writes)
+
+void handleNoteOn( byte channel, byte midiNote, byte velocity );               // The sketch's handlers
+void handleNoteOff( byte channel, byte midiNote, byte velocity );
+void handlePitchBend( byte channel, int16_t pitchBend );
+void handleControlChange( byte channel, byte command, byte val );
+void handleProgramChange( byte channel, byte patchIndex );
+
+
+/*******************************************
+ * Scenarios                               *
+ *******************************************/
+
+static std::string baseName( const char *path ){                               // scenarios/notes.txt -> notes
+  std::string name = path;
+  size_t slash = name.find_last_of( '/' );
+  if( slash != std::string::npos ) name = name.substr( slash + 1 );
+  size_t dot = name.find_last_of( '.' );
+  if( dot != std::string::npos ) name = name.substr( 0, dot );
+  return( name );
+}
+
+static bool runScenario( const char *path ){                                   // Play a scenario into bus_log (false if the script is bad)
+  FILE *f = fopen( path, "r" );
+  if( !f ){ printf( "%s: can't open\n", path ); return( false ); }
+
+  setup();
+  hostRun( 10 );                                                               // Let anything setup started settle
+  unsigned long start = host_us;
+  bus_log.clear();
+  bus_record = true;
+
+  char line[1024];                                                             // Room for a whole patch message on one line
+  int  line_no = 0;
+  bool ok = true;
+  while( ok && fgets( line, sizeof(line), f ) ){
+    line_no++;
+    char *hash = strchr( line, '#' );
+    if( hash ) *hash = 0;
+    char cmd[16];
+    int  a = 0, b = 0, c = 0, n = 0;
+    if( sscanf( line, "%15s%n", cmd, &n ) < 1 ) continue;                      // Blank line
+    const char *args = line + n;
+    int count = sscanf( args, "%d %d %d", &a, &b, &c );
+
+    if(      !strcmp( cmd, "on" )   && count == 3 ) handleNoteOn( a, b, c );
+    else if( !strcmp( cmd, "off" )  && count >= 2 ) handleNoteOff( a, b, count == 3 ? c : 0 );
+    else if( !strcmp( cmd, "bend" ) && count == 2 ) handlePitchBend( a, b );
+    else if( !strcmp( cmd, "cc" )   && count == 3 ) handleControlChange( a, b, c );
+    else if( !strcmp( cmd, "prog" ) && count == 2 ) handleProgramChange( a, b );
+    else if( !strcmp( cmd, "wait" ) && count == 1 ) hostRun( a );
+    else if( !strcmp( cmd, "midi" ) ){
+      uint8_t data[256];
+      size_t  len = 0;
+      unsigned val;
+      while( len < sizeof(data) && sscanf( args, " %x%n", &val, &n ) == 1 ){
+        data[len++] = val;
+        args += n;
+      }
+      if( !hostMidi( data, len ) ) printf( "%s:%d: MIDI input overran\n", path, line_no );
+    }
+    else {
+      printf( "%s:%d: can't understand \"%s\"\n", path, line_no, cmd );
+      ok = false;
+    }
+  }
+  fclose( f );
+
+  bus_record = false;
+  for( BusWrite &w : bus_log ) w.time -= start;                                // Times from the start of the script
+  return( ok );
+}
+
+
+/*******************************************
+ * Golden Traces                           *
+ *******************************************/
+
+static bool readTrace( const std::string &path, std::vector<BusWrite> &trace ){ // Load a golden trace (false if there isn't one)
+  FILE *f = fopen( path.c_str(), "r" );
+  if( !f ) return( false );
+  char line[128];
+  while( fgets( line, sizeof(line), f ) ){
+    unsigned long time;
+    unsigned reg, val;
+    if( line[0] == '#' ) continue;
+    if( sscanf( line, "%lu %x %x", &time, &reg, &val ) == 3 ) trace.push_back( { (uint32_t)time, (uint8_t)reg, (uint8_t)val } );
+  }
+  fclose( f );
+  return( true );
+}
+
+static bool writeTrace( const std::string &path, const std::string &name, const std::vector<BusWrite> &trace ){
+  FILE *f = fopen( path.c_str(), "w" );
+  if( !f ) return( false );
+  fprintf( f, "# YM3812 register trace: %s\n", name.c_str() );
+  fprintf( f, "# writes: %zu\n", trace.size() );
+  fprintf( f, "#     time reg val\n" );
+  for( const BusWrite &w : trace ) fprintf( f, "%10lu  %02X  %02X\n", (unsigned long)w.time, w.reg, w.val );
+  fclose( f );
+  return( true );
+}
+
+
+/*******************************************
+ * Diff                                    *
+ *******************************************/
+
+static bool sameWrite( const BusWrite &a, const BusWrite &b ){ return( a.reg == b.reg && a.val == b.val ); }
+
+static void diffLine( char mark, const BusWrite &w, int &shown ){
+  if( shown++ == TRACE_DIFF_LINES ) printf( "    ...\n" );
+  if( shown > TRACE_DIFF_LINES ) return;
+  printf( "  %c %10lu  %02X  %02X\n", mark, (unsigned long)w.time, w.reg, w.val );
+}
+
+static void showDiff( const std::vector<BusWrite> &want, const std::vector<BusWrite> &got ){
+  size_t start = 0;                                                            // Skip the writes both start with
+  while( start < want.size() && start < got.size() && sameWrite( want[start], got[start] ) ) start++;
+  size_t end_want = want.size(), end_got = got.size();                         // and the ones they both end with
+  while( end_want > start && end_got > start && sameWrite( want[end_want-1], got[end_got-1] ) ){ end_want--; end_got--; }
+
+  if( start == want.size() && start == got.size() ){                           // Writes all match, so only the times moved
+    for( size_t i = 0; i < want.size(); i++ ){
+      if( want[i].time == got[i].time ) continue;
+      printf( "  same writes, but the timing moved from write %zu on (%lu us -> %lu us)\n", i + 1,
+              (unsigned long)want[i].time, (unsigned long)got[i].time );
+      return;
+    }
+    return;
+  }
+
+  size_t n = end_want - start, m = end_got - start;
+  int shown = 0;
+  printf( "  @@ write %zu @@\n", start + 1 );
+  for( size_t i = (start > TRACE_CONTEXT) ? start - TRACE_CONTEXT : 0; i < start; i++ ) diffLine( ' ', got[i], shown );
+
+  if( (n + 1) * (m + 1) > TRACE_DIFF_CELLS ){                                  // Too far apart to line up, just show both
+    for( size_t i = 0; i < n; i++ ) diffLine( '-', want[start + i], shown );
+    for( size_t j = 0; j < m; j++ ) diffLine( '+', got[start + j], shown );
+  } else {
+    std::vector<uint16_t> lcs( (n + 1) * (m + 1), 0 );                         // lcs[i][j] = common writes in want[i..] and got[j..]
+    for( size_t i = n; i-- > 0; ){
+      for( size_t j = m; j-- > 0; ){
+        lcs[i*(m+1) + j] = sameWrite( want[start + i], got[start + j] ) ? lcs[(i+1)*(m+1) + j+1] + 1
+                         : std::max( lcs[(i+1)*(m+1) + j], lcs[i*(m+1) + j+1] );
+      }
+    }
+    size_t i = 0, j = 0, same = 0;                                             // Walk it, keeping only a little context between changes
+    while( i < n || j < m ){
+      if( i < n && j < m && sameWrite( want[start + i], got[start + j] ) ){
+        if( same++ < TRACE_CONTEXT ) diffLine( ' ', got[start + j], shown );
+        else if( same == TRACE_CONTEXT + 1 ) printf( "    ...\n" );
+        i++; j++;
+      } else {
+        same = 0;
+        if( i < n && (j == m || lcs[(i+1)*(m+1) + j] >= lcs[i*(m+1) + j+1]) ) diffLine( '-', want[start + i++], shown );
+        else diffLine( '+', got[start + j++], shown );
+      }
+    }
+  }
+  for( size_t j = end_got; j < got.size() && j < end_got + TRACE_CONTEXT; j++ ) diffLine( ' ', got[j], shown );
+}
+
+
+/*******************************************
+ * Main                                    *
+ *******************************************/
+
+static int testScenario( const char *path, bool update ){                      // 0 = passed, 1 = failed
+  std::string name   = baseName( path );
+  std::string golden = std::string( "golden/" ) + name + ".trace";
+
+  if( !runScenario( path ) ) return( 1 );
+  if( update ){
+    if( !writeTrace( golden, name, bus_log ) ){ printf( "%-20s can't write %s\n", name.c_str(), golden.c_str() ); return( 1 ); }
+    printf( "RECORDED %-20s %6zu writes\n", name.c_str(), bus_log.size() );
+    return( 0 );
+  }
+
+  std::vector<BusWrite> want;
+  if( !readTrace( golden, want ) ){ printf( "FAIL     %-20s no golden trace (%s), run with --update\n", name.c_str(), golden.c_str() ); return( 1 ); }
+
+  bool same = want.size() == bus_log.size();
+  for( size_t i = 0; same && i < want.size(); i++ ) same = sameWrite( want[i], bus_log[i] ) && want[i].time == bus_log[i].time;
+  if( same ){
+    printf( "PASS     %-20s %6zu writes\n", name.c_str(), bus_log.size() );
+    return( 0 );
+  }
+  long change = (long)bus_log.size() - (long)want.size();
+  printf( "FAIL     %-20s %6zu writes (golden %zu, %+ld)\n", name.c_str(), bus_log.size(), want.size(), change );
+  showDiff( want, bus_log );
+  return( 1 );
+}
+
+int main( int argc, char **argv ){
+  bool update = false;
+  int  failed = 0, run = 0;
+  for( int i = 1; i < argc; i++ ){
+    if( !strcmp( argv[i], "--update" ) ){ update = true; continue; }
+    fflush( stdout );
+    pid_t pid = fork();                                                        // Fresh sketch state for every scenario
+    if( pid == 0 ) exit( testScenario( argv[i], update ) );
+    int status = 1;
+    waitpid( pid, &status, 0 );
+    if( !WIFEXITED( status ) || WEXITSTATUS( status ) ){
+      if( !WIFEXITED( status ) ) printf( "FAIL     %-20s crashed\n", baseName( argv[i] ).c_str() );
+      failed++;
+    }
+    run++;
+  }
+  printf( "%d of %d scenarios passed\n", run - failed, run );
+  return( failed ? 1 : 0 );
+}
@@ -0,0 +1,94 @@
+#ifndef HOST_ARDUINO_H
+#define HOST_ARDUINO_H
+
+// Just enough of DxCore's Arduino.h to build the sketch on a PC (see HostTest.h). Time only moves when the test
+// moves it (hostAdvance), or when the code waits (delay, delayMicroseconds), so every run is the same.
+
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+#include <stdio.h>
+
+typedef uint8_t byte;
+
+#define F_CPU                  24000000UL
+#define SERIAL_RX_BUFFER_SIZE  64
+
+// Program memory is ordinary memory here
+#define PROGMEM
+#define pgm_read_byte(p)       (*(const uint8_t  *)(p))
+#define pgm_read_byte_near(p)  (*(const uint8_t  *)(p))
+#define pgm_read_word(p)       (*(const uint16_t *)(p))
+#define pgm_read_word_near(p)  (*(const uint16_t *)(p))
+#define pgm_read_dword(p)      (*(const uint32_t *)(p))
+#define pgm_read_ptr(p)        (*(const void * const *)(p))
+#define memcpy_P               memcpy
+
+#ifndef min
+  #define min(a,b)             ((a)<(b)?(a):(b))
+  #define max(a,b)             ((a)>(b)?(a):(b))
+#endif
+#define constrain(x,a,b)       ((x)<(a)?(a):((x)>(b)?(b):(x)))
+
+// Time
+unsigned long millis();
+unsigned long micros();
+void delay( unsigned long ms );
+void delayMicroseconds( unsigned int us );
+
+// Interrupts (nothing runs behind the test's back, so there is nothing to hold off)
+inline void cli(){}
+inline void sei(){}
+#define ISR(vector)            extern "C" void vector( void )
+
+// Peripherals the sketch touches directly. Writes land in plain structs and do nothing.
+struct PORT_t { volatile uint8_t DIR, DIRSET, DIRCLR, OUT, OUTSET, OUTCLR, OUTTGL, IN; };
+extern PORT_t PORTD;
+
+struct TCB_t { volatile uint8_t CTRLA, CTRLB, EVCTRL, INTCTRL, INTFLAGS, STATUS, DBGCTRL, TEMP; volatile uint16_t CNT, CCMP; };
+extern TCB_t TCB0, TCB1;
+#define TCB_CLKSEL_DIV1_gc     0x00
+#define TCB_CLKSEL_DIV2_gc     0x02
+#define TCB_ENABLE_bm          0x01
+#define TCB_RUNSTDBY_bm        0x40
+#define TCB_CNTMODE_INT_gc     0x00
+#define TCB_CAPT_bm            0x01
+extern "C" void TCB0_INT_vect( void );                                         // The control tick (HostTest calls it on time)
+
+// Serial ports
+class Print {
+  public:
+    virtual size_t write( uint8_t data ){ return( 0 ); }
+    size_t print( const char *s )   { size_t n = 0; while( *s ) n += write( *s++ ); return( n ); }
+    size_t print( char c )          { return( write( c ) ); }
+    size_t print( unsigned long v ) { char s[12]; snprintf( s, sizeof(s), "%lu", v ); return( print( s ) ); }
+    size_t print( long v )          { char s[12]; snprintf( s, sizeof(s), "%ld", v ); return( print( s ) ); }
+    size_t print( unsigned int v )  { return( print( (unsigned long)v ) ); }
+    size_t print( int v )           { return( print( (long)v ) ); }
+    size_t println()                { return( print( "\r\n" ) ); }
+    template<class T> size_t println( T v ){ return( print( v ) + println() ); }
+};
+
+class Stream : public Print {
+  public:
+    virtual int available(){ return( 0 ); }
+    virtual int read(){ return( -1 ); }
+};
+
+class HardwareSerial : public Stream {                                         // Receives what the test feeds it, keeps what gets sent
+  public:
+    uint8_t  rx[ SERIAL_RX_BUFFER_SIZE ];                                      // Ring like the real one, so overruns behave the same
+    uint8_t  rx_head = 0, rx_tail = 0;
+    uint8_t  tx[ 1024 ];                                                       // Everything written (the first 1K of it)
+    size_t   tx_len = 0;
+
+    void     begin( unsigned long baud ){}
+    bool     feed( uint8_t data );                                             // Data arriving from outside (false if the buffer is full)
+    int      available(){ return( (uint8_t)(rx_head - rx_tail) % SERIAL_RX_BUFFER_SIZE ); }
+    int      read();
+    int      availableForWrite(){ return( 64 ); }
+    size_t   write( uint8_t data ){ if( tx_len < sizeof(tx) ) tx[tx_len] = data; tx_len++; return( 1 ); }
+};
+extern HardwareSerial Serial, Serial2;
+
+#endif  // HOST_ARDUINO_H
@@ -0,0 +1,22 @@
+#ifndef HOST_EEPROM_H
+#define HOST_EEPROM_H
+
+// The AVR128DA's 512 bytes of EEPROM, starting out erased. Writes finish straight away (EEBUSY never sets).
+
+#include <stdint.h>
+
+struct EEPROMClass {
+  uint8_t  mem[512];
+  uint32_t writes = 0;                                                         // Bytes written, to keep an eye on wear
+  EEPROMClass(){ for( int i = 0; i < 512; i++ ) mem[i] = 0xFF; }
+  uint8_t  read( int addr ){ return( mem[addr & 511] ); }
+  void     write( int addr, uint8_t val ){ mem[addr & 511] = val; writes++; }
+  void     update( int addr, uint8_t val ){ if( read( addr ) != val ) write( addr, val ); }
+};
+extern EEPROMClass EEPROM;
+
+struct NVMCTRL_t { volatile uint8_t STATUS; };
+extern NVMCTRL_t NVMCTRL;
+#define NVMCTRL_EEBUSY_bm      0x02
+
+#endif  // HOST_EEPROM_H
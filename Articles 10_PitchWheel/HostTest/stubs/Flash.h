@@ -0,0 +1,36 @@
+#ifndef HOST_FLASH_H
+#define HOST_FLASH_H
+
+// DxCore's Flash library for the host build. The user bank is a const array, which the PC keeps in read only
+// memory, so the page is made writable before it gets erased or written.
+
+#include <stdint.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/mman.h>
+
+#define FLASHWRITE_OK          0
+
+struct FlashClass {
+  uint32_t erases = 0;                                                         // Pages erased, to keep an eye on wear
+  uint8_t  checkWritable(){ return( FLASHWRITE_OK ); }
+  uint8_t  erasePage( uint32_t addr, uint8_t pages = 1 ){
+    unlock( addr, 512 * pages );
+    memset( (void *)(uintptr_t)addr, 0xFF, 512 * pages );
+    erases += pages;
+    return( FLASHWRITE_OK );
+  }
+  uint8_t  writeWords( uint32_t addr, const uint16_t *data, uint16_t words ){
+    unlock( addr, words * 2 );
+    memcpy( (void *)(uintptr_t)addr, data, words * 2 );
+    return( FLASHWRITE_OK );
+  }
+  void     unlock( uint32_t addr, uint32_t len ){
+    uintptr_t page = sysconf( _SC_PAGESIZE );
+    uintptr_t start = (uintptr_t)addr & ~(page - 1);
+    mprotect( (void *)start, ((uintptr_t)addr + len - start + page - 1) & ~(page - 1), PROT_READ | PROT_WRITE );
+  }
+};
+extern FlashClass Flash;
+
+#endif  // HOST_FLASH_H
@@ -0,0 +1,23 @@
+#ifndef HOST_MIDI_H
+#define HOST_MIDI_H
+
+// Stand-in for the FortySevenEffects MIDI library, so a MIDI_PARSER 0 build still compiles on the host. It never
+// reads anything; the tests call the handlers directly, or use MidiParser (MIDI_PARSER 1).
+
+#include <stdint.h>
+
+namespace midi {
+  template<class Transport> struct MidiInterface {
+    template<class Fn> void setHandleNoteOn( Fn fn ){}
+    template<class Fn> void setHandleNoteOff( Fn fn ){}
+    template<class Fn> void setHandleProgramChange( Fn fn ){}
+    template<class Fn> void setHandlePitchBend( Fn fn ){}
+    template<class Fn> void setHandleControlChange( Fn fn ){}
+    template<class Fn> void setHandleSystemExclusive( Fn fn ){}
+    void begin( int channel = 1 ){}
+    bool read( int channel = 0 ){ return( false ); }
+  };
+}
+#define MIDI_CREATE_INSTANCE( Type, SerialPort, Name ) midi::MidiInterface<Type> Name;
+
+#endif  // HOST_MIDI_H
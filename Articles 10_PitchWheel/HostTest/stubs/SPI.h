@@ -0,0 +1,14 @@
+#ifndef HOST_SPI_H
+#define HOST_SPI_H
+
+// SPI for the host build. The bytes go nowhere; the tests watch the writes through ymBusTrace instead.
+
+#include <stdint.h>
+
+struct SPIClass {
+  void    begin(){}
+  uint8_t transfer( uint8_t data ){ return( 0 ); }
+};
+extern SPIClass SPI;
+
+#endif  // HOST_SPI_H
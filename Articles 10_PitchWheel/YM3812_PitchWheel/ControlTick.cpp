@@ -0,0 +1,132 @@
+/*
+     _____.___.  _____  ________    ______  ____________
+     \__  |   | /     \ \_____  \  /  __  \/_   \_____  \
+      /   |   |/  \ /  \  _(__  <  >      < |   |/  ____/
+      \____   /    Y    \/       \/   --   \|   /       \
+      / ______\____|__  /______  /\______  /|___\_______ \
+      \/              \/       \/        \/             \/
+            ________ __________.____    ________
+            \_____  \\______   \    |   \_____  \
+             /   |   \|     ___/    |    /  ____/
+            /    |    \    |   |    |___/       \
+            \_______  /____|   |_______ \_______ \
+                    \/                 \/       \/
+
+
+YM3182 OPL2 LIBRARY source code designed to run on the AVR128DA28.
+Copyright (C) 2022 Tyler Klein
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program. If not, see <https://www.gnu.org/licenses/>.
+
+Description:
+Fixed rate control tick scheduler. See ControlTick.h for the theory of operation.
+
+*/
+
+#include "Arduino.h"
+#include "ControlTick.h"
+
+static volatile uint8_t ticks_due = 0;                                         // Ticks counted by the timer that haven't been run yet
+
+ISR( TCB0_INT_vect ){                                                          // Timer interrupt, once per tick
+  TCB0.INTFLAGS = TCB_CAPT_bm;                                                 // Clear the interrupt flag
+  if( ticks_due < 0xFF ) ticks_due++;                                          // Count the tick (run() does the work)
+}
+
+
+void ControlTick::begin( uint16_t hz ){
+  if( hz < CTRL_MIN_RATE ) hz = CTRL_MIN_RATE;                                 // Keep the period within the 16-bit timer
+  rate = hz;
+
+  TCB0.CTRLA    = 0;                                                           // Stop the timer while setting it up
+  TCB0.CTRLB    = TCB_CNTMODE_INT_gc;                                          // Periodic interrupt mode
+  TCB0.CCMP     = CTRL_TIMER_CLOCK / hz - 1;                                   // Count this far for each tick
+  TCB0.CNT      = 0;
+  TCB0.INTFLAGS = TCB_CAPT_bm;
+  TCB0.INTCTRL  = TCB_CAPT_bm;                                                 // Interrupt at the end of every period
+  TCB0.CTRLA    = TCB_CLKSEL_DIV2_gc | TCB_ENABLE_bm;                          // Start counting at half the CPU clock
+}
+
+uint8_t ControlTick::addTask( void (*fn)(), const char *name ){
+  if( num_tasks >= CTRL_MAX_TASKS ) return( 0xFF );                            // No room left in the table
+  tasks[num_tasks].tick = fn;
+  tasks[num_tasks].name = name;
+  return( num_tasks++ );
+}
+
+uint8_t ControlTick::addVoiceTask( void (*fn)( uint8_t v ), uint8_t voices, const char *name ){
+  if( num_tasks >= CTRL_MAX_TASKS ) return( 0xFF );                            // No room left in the table
+  tasks[num_tasks].voice  = fn;
+  tasks[num_tasks].voices = voices;
+  tasks[num_tasks].name   = name;
+  if( voices > max_voices ) max_voices = voices;                               // Voices are handed out up to the largest count
+  return( num_tasks++ );
+}
+
+bool ControlTick::run(){
+  cli();
+  uint8_t due = ticks_due;                                                     // Grab the number of ticks that are due
+  ticks_due = 0;
+  sei();
+  if( !due ) return( false );                                                  // Nothing to do yet
+  overruns += due - 1;                                                         // Any more than one means we fell behind
+
+  unsigned long tick_start = micros();
+  unsigned long start, elapsed;
+
+  for( uint8_t t = 0; t < num_tasks; t++ ){                                    // Tick tasks first, they run every time
+    if( !tasks[t].tick ) continue;
+    start = micros();
+    tasks[t].tick();
+    elapsed = micros() - start;
+    if( elapsed > tasks[t].worst_us ) tasks[t].worst_us = elapsed;
+  }
+
+  for( uint8_t i = 0; i < max_voices; i++ ){                                   // Then the voice tasks, one voice at a time
+    if( i && micros() - tick_start >= budget_us ) break;                       // Out of time (after at least one voice), the next tick carries on
+    uint8_t v = next_voice;
+    if( ++next_voice >= max_voices ) next_voice = 0;
+
+    for( uint8_t t = 0; t < num_tasks; t++ ){                                  // Run every voice task for the voice
+      if( !tasks[t].voice || v >= tasks[t].voices ) continue;
+      start = micros();
+      tasks[t].voice( v );
+      elapsed = micros() - start;
+      if( elapsed > tasks[t].worst_us ) tasks[t].worst_us = elapsed;
+    }
+  }
+
+  elapsed = micros() - tick_start;
+  if( elapsed > worst_us ) worst_us = elapsed;                                 // Keep track of the longest tick
+  ticks++;
+  busy_us += elapsed;
+  if( ++load_ticks >= rate ){                                                  // Once a second, work out the load
+    load = busy_us / 10000;                                                    // Percentage of 1,000,000 micros
+    busy_us = 0;
+    load_ticks = 0;
+  }
+  return( true );
+}
+
+void ControlTick::report( Print &out ){
+  out.print( "Control tick: " );   out.print( rate );      out.print( "Hz, " );
+  out.print( ticks );              out.print( " ticks, " );
+  out.print( overruns );           out.print( " overruns, worst " );
+  out.print( worst_us );           out.print( "us, load " );
+  out.print( load );               out.println( "%" );
+  for( uint8_t t = 0; t < num_tasks; t++ ){
+    out.print( "  " );             out.print( tasks[t].name );
+    out.print( ": worst " );       out.print( tasks[t].worst_us ); out.println( "us" );
+  }
+}
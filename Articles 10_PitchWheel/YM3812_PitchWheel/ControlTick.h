@@ -0,0 +1,107 @@
+#ifndef CONTROLTICK_H
+#define CONTROLTICK_H
+
+/*
+     _____.___.  _____  ________    ______  ____________
+     \__  |   | /     \ \_____  \  /  __  \/_   \_____  \
+      /   |   |/  \ /  \  _(__  <  >      < |   |/  ____/
+      \____   /    Y    \/       \/   --   \|   /       \
+      / ______\____|__  /______  /\______  /|___\_______ \
+      \/              \/       \/        \/             \/
+            ________ __________.____    ________
+            \_____  \\______   \    |   \_____  \
+             /   |   \|     ___/    |    /  ____/
+            /    |    \    |   |    |___/       \
+            \_______  /____|   |_______ \_______ \
+                    \/                 \/       \/
+
+
+YM3182 OPL2 LIBRARY source code designed to run on the AVR128DA28.
+Copyright (C) 2022 Tyler Klein
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program. If not, see <https://www.gnu.org/licenses/>.
+
+--- Description: ---
+A fixed rate control tick for everything that needs to happen regularly rather than in response to MIDI, like
+applying pitch bends and stepping envelopes. A hardware timer (TCB0) sets the pace, but the work itself happens
+in the main loop, so the MIDI callbacks never get interrupted half way through changing the channel states.
+
+
+--- Theory of Operation: ---
+TIMER:
+TCB0 runs in periodic interrupt mode. All the interrupt does is count how many ticks are due. run() gets called
+from loop(), and when a tick is due it runs the tasks. If more than one tick piled up while loop() was busy, the
+extra ticks are counted as overruns and skipped (the tasks catch up on their own, see pegUpdate in YM3812.cpp).
+
+TASKS:
+Tasks live in a fixed size table, so nothing gets allocated. There are two kinds:
+  - Tick tasks run once every tick. They should be short and take about the same time every tick.
+  - Voice tasks run once for each voice (YM3812 channel). Voices are handled in turn until the tick's time
+    budget runs out, and the next tick picks up from the next voice. Busy ticks just spread the voices out.
+
+STATISTICS:
+run() measures every task and keeps the worst case, along with the worst tick, the number of overruns and the
+CPU load (time spent in ticks over the last second). report() prints them all.
+
+*/
+
+#include "Arduino.h"
+
+#define CTRL_MAX_TASKS     8                                                                      // Size of the task table
+#define CTRL_TIMER_CLOCK   (F_CPU / 2)                                                            // TCB0 counts at half the CPU clock
+#define CTRL_MIN_RATE      (CTRL_TIMER_CLOCK / 0xFFFF + 1)                                        // Slowest tick rate (Hz) the 16-bit timer can manage
+
+struct ControlTask{
+  void        (*tick)()              = NULL;                                                      // Function for a tick task
+  void        (*voice)( uint8_t v )  = NULL;                                                      // Function for a voice task
+  uint8_t       voices               = 0;                                                         // Number of voices a voice task covers
+  const char   *name                 = NULL;                                                      // Name shown in the report
+  uint16_t      worst_us             = 0;                                                         // Longest single call (micros)
+};
+
+
+class ControlTick {                                                                               // ControlTick Class
+  private:
+    ControlTask tasks[CTRL_MAX_TASKS];                                                            // Task table
+    uint8_t     num_tasks    = 0;                                                                 // Number of tasks in the table
+    uint8_t     next_voice   = 0;                                                                 // Voice the next tick starts on
+    uint8_t     max_voices   = 0;                                                                 // Largest number of voices of any voice task
+
+    uint16_t    rate         = 500;                                                               // Tick rate (Hz)
+    uint16_t    budget_us    = 1000;                                                              // Time (micros) a tick may spend on voice tasks
+
+    // Statistics
+    uint32_t    ticks        = 0;                                                                 // Number of ticks run
+    uint32_t    overruns     = 0;                                                                 // Number of ticks skipped because loop() fell behind
+    uint16_t    worst_us     = 0;                                                                 // Longest tick (micros)
+    uint32_t    busy_us      = 0;                                                                 // Time spent in ticks since the load was last worked out
+    uint16_t    load_ticks   = 0;                                                                 // Ticks since the load was last worked out
+    uint8_t     load         = 0;                                                                 // Percentage of the last second spent in ticks
+
+  public:
+    void     begin( uint16_t hz );                                                                // Start the timer ticking at hz
+    uint8_t  addTask( void (*fn)(), const char *name );                                           // Run fn every tick (returns 0xFF if the table is full)
+    uint8_t  addVoiceTask( void (*fn)( uint8_t v ), uint8_t voices, const char *name );           // Run fn for each voice, in turns (0xFF if full)
+    void     setBudget( uint16_t us ){ budget_us = us; }                                          // Set the time (micros) per tick for voice tasks
+    bool     run();                                                                               // Run a tick if one is due (call from loop)
+
+    uint16_t getRate(){      return( rate );     }                                                // Tick rate (Hz)
+    uint32_t getOverruns(){  return( overruns ); }                                                // Ticks skipped so far
+    uint16_t getWorstTick(){ return( worst_us ); }                                                // Longest tick (micros)
+    uint8_t  getLoad(){      return( load );     }                                                // CPU load of the ticks (percent)
+    void     report( Print &out );                                                                // Print the statistics
+};
+
+
+#endif  // CONTROLTICK_H
@@ -0,0 +1,116 @@
+/*
+     _____.___.  _____  ________    ______  ____________
+     \__  |   | /     \ \_____  \  /  __  \/_   \_____  \
+      /   |   |/  \ /  \  _(__  <  >      < |   |/  ____/
+      \____   /    Y    \/       \/   --   \|   /       \
+      / ______\____|__  /______  /\______  /|___\_______ \
+      \/              \/       \/        \/             \/
+            ________ __________.____    ________
+            \_____  \\______   \    |   \_____  \
+             /   |   \|     ___/    |    /  ____/
+            /    |    \    |   |    |___/       \
+            \_______  /____|   |_______ \_______ \
+                    \/                 \/       \/
+
+
+YM3182 OPL2 LIBRARY source code designed to run on the AVR128DA28.
+Copyright (C) 2022 Tyler Klein
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program. If not, see <https://www.gnu.org/licenses/>.
+
+Description:
+Running status MIDI parser. See MidiParser.h for the theory of operation.
+
+*/
+
+#include "Arduino.h"
+#include "MidiParser.h"
+#include "Profiler.h"
+
+
+void MidiParser::begin( HardwareSerial &serial ){
+  serial.begin( 31250 );                                                       // MIDI baud rate
+  port = &serial;
+  status = count = sysex_len = 0;
+  in_sysex = false;
+}
+
+
+bool MidiParser::sysexChunk( MidiEvent &event, uint8_t flags ){                // Pass on the SysEx data collected so far
+  memcpy( sysex_out, sysex_buf, sysex_len );                                   // Keep it around while more bytes arrive
+  event.type    = MIDI_SYSEX;
+  event.channel = 0;
+  event.data1   = sysex_len;
+  event.data2   = sysex_flags | flags;
+  sysex_flags   = 0;                                                           // Only the first chunk is the start
+  sysex_len     = 0;
+  return( true );
+}
+
+
+bool MidiParser::parse( uint8_t data, MidiEvent &event ){
+  PROFILE_ZONE( PROF_PARSE );
+  if( data >= 0xF8 ) return( false );                                          // Real time, ignore it without touching anything else
+
+  if( data & 0x80 ){                                                           // Status byte
+    bool ended = in_sysex;                                                     // Any status byte ends a SysEx message
+    if( ended ) sysexChunk( event, MIDI_SYSEX_END );                           // Pass on the rest of it before an F0 starts the next one
+    in_sysex = false;
+
+    switch( data ){
+      case 0xF0:                                                               // SysEx start
+        in_sysex = true;
+        sysex_len = 0;
+        sysex_flags = MIDI_SYSEX_START;
+        status = 0;
+        break;
+      case 0xF7:                                                               // SysEx end
+        status = 0;
+        break;
+      default:
+        status = (data < 0xF0) ? data : 0;                                     // Channel messages set the running status, system common clears it
+        count = 0;
+        break;
+    }
+    return( ended );
+  }
+
+  if( in_sysex ){                                                              // SysEx data byte
+    sysex_buf[ sysex_len++ ] = data;
+    if( sysex_len == MIDI_SYSEX_CHUNK ) return( sysexChunk( event, 0 ) );      // Buffer is full, pass it on
+    return( false );
+  }
+
+  if( !status ) return( false );                                               // Data without a status to go with it
+
+  uint8_t type = status & 0xF0;
+  if( count == 0 && type != MIDI_PROGRAM && type != MIDI_PRESSURE ){           // First of two data bytes
+    data1 = data;
+    count = 1;
+    return( false );
+  }
+
+  count = 0;                                                                   // Message is complete (running status carries on)
+  event.channel = (status & 0x0F) + 1;
+  if( type == MIDI_PROGRAM || type == MIDI_PRESSURE ){
+    event.data1 = data;
+    event.data2 = 0;
+  } else {
+    event.data1 = data1;
+    event.data2 = data;
+  }
+  if( type == MIDI_NOTE_ON && data == 0 ) type = MIDI_NOTE_OFF;                // Zero velocity is a note off
+  event.type = type;
+  return( true );
+}
@@ -0,0 +1,116 @@
+#ifndef MIDIPARSER_H
+#define MIDIPARSER_H
+
+/*
+     _____.___.  _____  ________    ______  ____________
+     \__  |   | /     \ \_____  \  /  __  \/_   \_____  \
+      /   |   |/  \ /  \  _(__  <  >      < |   |/  ____/
+      \____   /    Y    \/       \/   --   \|   /       \
+      / ______\____|__  /______  /\______  /|___\_______ \
+      \/              \/       \/        \/             \/
+            ________ __________.____    ________
+            \_____  \\______   \    |   \_____  \
+             /   |   \|     ___/    |    /  ____/
+            /    |    \    |   |    |___/       \
+            \_______  /____|   |_______ \_______ \
+                    \/                 \/       \/
+
+
+YM3182 OPL2 LIBRARY source code designed to run on the AVR128DA28.
+Copyright (C) 2022 Tyler Klein
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program. If not, see <https://www.gnu.org/licenses/>.
+
+--- Description: ---
+A small running status MIDI parser that reads straight from a serial port's receive buffer. It turns the bytes
+into compact MidiEvent structures and leaves the dispatching to a switch in the sketch, instead of calling back
+through function pointers like the MIDI library does. Nothing gets allocated and the state is only a few bytes.
+
+
+--- Theory of Operation: ---
+STATUS BYTES:
+Channel messages (0x80 - 0xEF) set the running status. Data bytes are collected until the message for that
+status is complete (one data byte for program change and channel pressure, two for everything else). After that
+the status stays in place, so a stream of data bytes without status bytes keeps producing messages of the same
+kind. System common messages (0xF1 - 0xF6) cancel the running status. Real time bytes (0xF8 - 0xFF) can turn up
+anywhere, even in the middle of another message, and are simply dropped without disturbing anything.
+
+NOTES:
+A note on with a velocity of zero is turned into a note off, the same as the MIDI library does by default.
+
+SYSEX:
+SysEx messages can be much longer than anything worth buffering, so they come out in chunks of up to
+MIDI_SYSEX_CHUNK bytes. Each chunk is a MIDI_SYSEX event: data1 holds the number of bytes (available through
+sysexData() until the next call to read), and data2 holds MIDI_SYSEX_START on the first chunk and MIDI_SYSEX_END
+on the last one. The 0xF0 and 0xF7 bytes themselves are left out. A status byte other than 0xF7 also ends a
+SysEx message (real time bytes excepted). If it is another 0xF0, the old message still gets its own last chunk
+with MIDI_SYSEX_END, and the new message starts fresh with MIDI_SYSEX_START on its first chunk.
+
+*/
+
+#include "Arduino.h"
+
+#define MIDI_SYSEX_CHUNK   32                                                                     // Largest piece of a SysEx message passed on at once
+
+// MidiEvent types (the status byte without the channel)
+#define MIDI_NOTE_OFF      0x80                                                                   // data1 = note,       data2 = velocity
+#define MIDI_NOTE_ON       0x90                                                                   // data1 = note,       data2 = velocity (never 0)
+#define MIDI_POLY_PRESSURE 0xA0                                                                   // data1 = note,       data2 = pressure
+#define MIDI_CONTROL       0xB0                                                                   // data1 = controller, data2 = value
+#define MIDI_PROGRAM       0xC0                                                                   // data1 = program
+#define MIDI_PRESSURE      0xD0                                                                   // data1 = pressure
+#define MIDI_PITCH_BEND    0xE0                                                                   // data1 = LSB,        data2 = MSB
+#define MIDI_SYSEX         0xF0                                                                   // data1 = length,     data2 = MIDI_SYSEX_START / MIDI_SYSEX_END flags
+
+#define MIDI_SYSEX_START   0b01                                                                   // Chunk is the start of a SysEx message
+#define MIDI_SYSEX_END     0b10                                                                   // Chunk is the end of a SysEx message
+
+struct MidiEvent{
+  uint8_t       type       = 0;                                                                   // Type of message (MIDI_*)
+  uint8_t       channel    = 0;                                                                   // Midi channel (1 - 16, like the MIDI library)
+  uint8_t       data1      = 0;                                                                   // First data byte
+  uint8_t       data2      = 0;                                                                   // Second data byte
+
+  int16_t       bend() const { return( ((data2 << 7) | data1) - 0x2000 ); }                       // Pitch bend value (-8192 ... 8191, like the MIDI library)
+};
+
+
+class MidiParser {                                                                                // MidiParser Class
+  private:
+    Stream     *port         = NULL;                                                              // Where the bytes come from
+    uint8_t     status       = 0;                                                                 // Running status (0 = none)
+    uint8_t     data1        = 0;                                                                 // First data byte of the message being collected
+    uint8_t     count        = 0;                                                                 // Number of data bytes collected so far
+    uint8_t     sysex_flags  = 0;                                                                 // In a SysEx message, MIDI_SYSEX_START until the first chunk is out
+    bool        in_sysex     = false;                                                             // Collecting a SysEx message
+    uint8_t     sysex_len    = 0;                                                                 // Bytes in sysex_buf
+    uint8_t     sysex_buf[MIDI_SYSEX_CHUNK];                                                      // The current chunk of SysEx data
+    uint8_t     sysex_out[MIDI_SYSEX_CHUNK];                                                      // The last chunk passed on (see sysexData)
+
+    bool        sysexChunk( MidiEvent &event, uint8_t flags );                                    // Pass on the SysEx data collected so far
+
+  public:
+    void        begin( HardwareSerial &serial );                                                  // Start listening on a serial port at the MIDI baud rate
+    bool        parse( uint8_t data, MidiEvent &event );                                          // Feed in one byte, true if it finished a message (in event)
+    bool        read( MidiEvent &event ){                                                         // Read waiting bytes until a message is complete, false once the buffer is empty
+      while( port && port->available() ){
+        if( parse( port->read(), event ) ) return( true );
+      }
+      return( false );
+    }
+    const uint8_t *sysexData(){ return( sysex_out ); }                                            // Data of the last MIDI_SYSEX event
+};
+
+
+#endif  // MIDIPARSER_H
@@ -0,0 +1,107 @@
+/*
+     _____.___.  _____  ________    ______  ____________
+     \__  |   | /     \ \_____  \  /  __  \/_   \_____  \
+      /   |   |/  \ /  \  _(__  <  >      < |   |/  ____/
+      \____   /    Y    \/       \/   --   \|   /       \
+      / ______\____|__  /______  /\______  /|___\_______ \
+      \/              \/       \/        \/             \/
+            ________ __________.____    ________
+            \_____  \\______   \    |   \_____  \
+             /   |   \|     ___/    |    /  ____/
+            /    |    \    |   |    |___/       \
+            \_______  /____|   |_______ \_______ \
+                    \/                 \/       \/
+
+
+YM3182 OPL2 LIBRARY source code designed to run on the AVR128DA28.
+Copyright (C) 2022 Tyler Klein
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program. If not, see <https://www.gnu.org/licenses/>.
+
+Description:
+Performance setup storage in EEPROM. See PerfStore.h for the theory of operation.
+
+*/
+
+#include "Arduino.h"
+#include "PerfStore.h"
+#include <EEPROM.h>
+#include <util/crc16.h>
+
+
+bool PerfStore::slotValid( uint8_t slot ){
+  uint16_t addr = slotAddr( slot );
+  if( EEPROM.read( addr + 1 ) != version ) return( false );                    // Erased, or an older layout
+
+  uint8_t crc = 0;
+  for( uint8_t i = 0; i < size; i++ ) crc = _crc8_ccitt_update( crc, EEPROM.read( addr + PERF_SLOT_HEADER + i ) );
+  return( crc == EEPROM.read( addr + PERF_SLOT_HEADER + size ) );
+}
+
+bool PerfStore::begin( uint8_t *rec, uint8_t len, uint8_t ver ){
+  record  = rec;
+  size    = len;
+  version = ver;
+  slots   = PERF_EEPROM_SIZE / (size + PERF_SLOT_HEADER + 1);
+  newest  = 0xFF;
+
+  for( uint8_t slot = 0; slot < slots; slot++ ){                               // Find the slot furthest ahead in the sequence
+    if( EEPROM.read( slotAddr( slot ) + 1 ) != version ) continue;
+    uint8_t s = EEPROM.read( slotAddr( slot ) );
+    if( newest == 0xFF || int8_t( s - seq ) > 0 ){ newest = slot; seq = s; }
+  }
+  if( newest == 0xFF ) return( false );                                        // Nothing saved yet
+
+  uint8_t slot = newest;
+  if( !slotValid( slot ) ){                                                    // Cut off part way through?
+    slot = (slot + slots - 1) % slots;                                         // Then the save before it is the one to use
+    if( !slotValid( slot ) || EEPROM.read( slotAddr( slot ) ) != uint8_t( seq - 1 ) ) return( false );
+  }
+  for( uint8_t i = 0; i < size; i++ ) record[i] = EEPROM.read( slotAddr( slot ) + PERF_SLOT_HEADER + i );
+  return( true );
+}
+
+void PerfStore::changed(){
+  pending     = true;
+  last_change = millis();
+}
+
+void PerfStore::service(){
+  if( !record ) return;
+  if( save_pos == 0xFFFF ){                                                    // Not saving, is it time to start?
+    if( !pending || millis() - last_change < PERF_SAVE_DELAY ) return;
+    pending   = false;
+    save_slot = (newest == 0xFF) ? 0 : (newest + 1) % slots;                   // Next slot round the ring
+    save_pos  = 0;
+    save_crc  = 0;
+  }
+  if( NVMCTRL.STATUS & NVMCTRL_EEBUSY_bm ) return;                             // Last byte still being written
+
+  uint16_t addr = slotAddr( save_slot );
+  if( save_pos < size ){                                                       // Record bytes
+    uint8_t data = record[save_pos];
+    save_crc = _crc8_ccitt_update( save_crc, data );
+    EEPROM.update( addr + PERF_SLOT_HEADER + save_pos, data );                 // (skips bytes that are already right)
+  }
+  else if( save_pos == size ) EEPROM.update( addr + PERF_SLOT_HEADER + size, save_crc );
+  else if( save_pos == size + 1 ) EEPROM.update( addr + 1, version );
+  else {
+    EEPROM.update( addr, ++seq );                                              // Sequence number last, so the slot only
+    newest   = save_slot;                                                      // counts once the rest is written
+    save_pos = 0xFFFF;
+    saves++;
+    return;
+  }
+  save_pos++;
+}
@@ -0,0 +1,100 @@
+#ifndef PERFSTORE_H
+#define PERFSTORE_H
+
+/*
+     _____.___.  _____  ________    ______  ____________
+     \__  |   | /     \ \_____  \  /  __  \/_   \_____  \
+      /   |   |/  \ /  \  _(__  <  >      < |   |/  ____/
+      \____   /    Y    \/       \/   --   \|   /       \
+      / ______\____|__  /______  /\______  /|___\_______ \
+      \/              \/       \/        \/             \/
+            ________ __________.____    ________
+            \_____  \\______   \    |   \_____  \
+             /   |   \|     ___/    |    /  ____/
+            /    |    \    |   |    |___/       \
+            \_______  /____|   |_______ \_______ \
+                    \/                 \/       \/
+
+
+YM3182 OPL2 LIBRARY source code designed to run on the AVR128DA28.
+Copyright (C) 2022 Tyler Klein
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program. If not, see <https://www.gnu.org/licenses/>.
+
+--- Description: ---
+Keeps a small record (the performance setup: which patch each channel uses, the bend range, the drum map) in
+EEPROM so it survives a power cycle. The sketch decides what goes in the record; this class only stores it.
+
+
+--- Theory of Operation: ---
+RING:
+EEPROM cells wear out after a limited number of writes, so rather than rewriting the same bytes every time the
+record goes into the next slot of a ring that fills the EEPROM. Each slot is a sequence number, the record
+version, the record itself and a CRC. The sequence number goes up by one with every save (wrapping at 256), so
+the newest slot is the one that is furthest ahead of the others. With PERF_SLOTS slots, each cell is written
+once every PERF_SLOTS saves.
+
+RESTORE:
+begin() reads the sequence number of every slot and checks the CRC of the newest one, then copies it into the
+record. If the newest slot is damaged (say the power went out part way through a save) it falls back to the
+slot before it. Reading EEPROM is just a memory read on the AVR Dx, so this is a few hundred bytes at most and
+doesn't hold up the first note. If no slot is any good the record is left alone, so whatever defaults the
+sketch put there stay.
+
+SAVING:
+Writing a byte of EEPROM takes milliseconds, far too long to wait for in loop(). changed() just notes the time.
+Once nothing has changed for PERF_SAVE_DELAY, service() starts a save and writes one byte each time it is
+called, and only when the EEPROM isn't still busy with the last one, so it never waits. The CRC is worked out
+from the bytes as they are written, and the sequence number goes in last. A save that gets cut off leaves a
+slot with an old sequence number and a bad CRC, which begin() passes over. If the record changes during a save,
+the save finishes anyway and another one follows once things settle down.
+
+*/
+
+#include "Arduino.h"
+
+#define PERF_EEPROM_START    0                                                                    // First EEPROM byte used by the ring
+#define PERF_EEPROM_SIZE     512                                                                  // EEPROM bytes used by the ring (all of it on the AVR128DA)
+#define PERF_SLOT_HEADER     2                                                                    // Sequence number and version before the record
+#define PERF_SAVE_DELAY      3000                                                                 // Milliseconds without changes before saving
+
+
+class PerfStore {                                                                                 // PerfStore Class
+  private:
+    uint8_t    *record       = NULL;                                                              // The sketch's record
+    uint8_t     size         = 0;                                                                 // Bytes in the record
+    uint8_t     version      = 0;                                                                 // Layout version of the record (old layouts are ignored)
+    uint8_t     slots        = 0;                                                                 // Slots in the ring
+    uint8_t     newest       = 0xFF;                                                              // Slot holding the last save (0xFF = none)
+    uint8_t     seq          = 0;                                                                 // Sequence number of the last save
+    bool        pending      = false;                                                             // Record changed since the last save started
+    unsigned long last_change = 0;                                                                // millis() of the last change
+    uint16_t    save_pos     = 0xFFFF;                                                            // Next byte of the save in progress (0xFFFF = not saving)
+    uint8_t     save_slot    = 0;                                                                 // Slot being written
+    uint8_t     save_crc     = 0;                                                                 // CRC of the bytes written so far
+    uint16_t    saves        = 0;                                                                 // Saves completed since power on
+
+    uint16_t    slotAddr( uint8_t slot ){ return( PERF_EEPROM_START + slot * (size + PERF_SLOT_HEADER + 1) ); } // EEPROM address of a slot
+    bool        slotValid( uint8_t slot );                                                        // Version and CRC of a slot check out
+
+  public:
+    bool        begin( uint8_t *rec, uint8_t len, uint8_t ver );                                  // Restore the newest good record (true if one was found)
+    void        changed();                                                                        // The record changed, save it once things settle
+    void        service();                                                                        // Keep a save moving (call often, from loop)
+    bool        saving(){ return( save_pos != 0xFFFF ); }                                         // A save is in progress
+    uint16_t    getSaves(){ return( saves ); }                                                    // Saves completed since power on
+};
+
+
+#endif  // PERFSTORE_H
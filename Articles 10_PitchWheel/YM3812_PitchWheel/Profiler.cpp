@@ -0,0 +1,73 @@
+/*
+     _____.___.  _____  ________    ______  ____________
+     \__  |   | /     \ \_____  \  /  __  \/_   \_____  \
+      /   |   |/  \ /  \  _(__  <  >      < |   |/  ____/
+      \____   /    Y    \/       \/   --   \|   /       \
+      / ______\____|__  /______  /\______  /|___\_______ \
+      \/              \/       \/        \/             \/
+            ________ __________.____    ________
+            \_____  \\______   \    |   \_____  \
+             /   |   \|     ___/    |    /  ____/
+            /    |    \    |   |    |___/       \
+            \_______  /____|   |_______ \_______ \
+                    \/                 \/       \/
+
+
+YM3182 OPL2 LIBRARY source code designed to run on the AVR128DA28.
+Copyright (C) 2022 Tyler Klein
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program. If not, see <https://www.gnu.org/licenses/>.
+
+Description:
+Profiling zones. See Profiler.h for the theory of operation.
+
+*/
+
+#include "Arduino.h"
+#include "Profiler.h"
+
+#if PROFILE
+
+ProfileZone profile_zones[PROF_ZONES];
+
+static const char *const PROF_NAMES[PROF_ZONES] = { "parse", "note on", "get next", "send patch", "send data" };
+
+
+void profileBegin(){
+  TCB1.CTRLA = 0;                                                              // Stop the timer while setting it up
+  TCB1.CTRLB = TCB_CNTMODE_INT_gc;                                             // Periodic mode, without the interrupt
+  TCB1.CCMP  = 0xFFFF;                                                         // Use the whole 16 bits
+  TCB1.CNT   = 0;
+  TCB1.CTRLA = TCB_CLKSEL_DIV1_gc | TCB_ENABLE_bm;                             // Count at the CPU clock
+}
+
+void profileReset(){
+  for( uint8_t i = 0; i < PROF_ZONES; i++ ) profile_zones[i] = ProfileZone();
+}
+
+void profileReport( Print &out ){
+  out.println( "Zone: calls / avg / max cycles" );
+  for( uint8_t i = 0; i < PROF_ZONES; i++ ){
+    ProfileZone &z = profile_zones[i];
+    out.print( PROF_NAMES[i] );
+    out.print( ": " );
+    out.print( z.count );
+    out.print( " / " );
+    out.print( z.count ? z.total / z.count : 0 );
+    out.print( " / " );
+    out.println( z.longest );
+  }
+}
+
+#endif
@@ -0,0 +1,106 @@
+#ifndef PROFILER_H
+#define PROFILER_H
+
+/*
+     _____.___.  _____  ________    ______  ____________
+     \__  |   | /     \ \_____  \  /  __  \/_   \_____  \
+      /   |   |/  \ /  \  _(__  <  >      < |   |/  ____/
+      \____   /    Y    \/       \/   --   \|   /       \
+      / ______\____|__  /______  /\______  /|___\_______ \
+      \/              \/       \/        \/             \/
+            ________ __________.____    ________
+            \_____  \\______   \    |   \_____  \
+             /   |   \|     ___/    |    /  ____/
+            /    |    \    |   |    |___/       \
+            \_______  /____|   |_______ \_______ \
+                    \/                 \/       \/
+
+
+YM3182 OPL2 LIBRARY source code designed to run on the AVR128DA28.
+Copyright (C) 2022 Tyler Klein
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program. If not, see <https://www.gnu.org/licenses/>.
+
+--- Description: ---
+Scoped profiling zones for the hot paths (MIDI parsing, finding a channel, sending patches, register writes), so
+we can see where the time goes on the real hardware. Set PROFILE to 1 to build them in. With PROFILE at 0 the
+zones are empty macros and nothing is left in the code.
+
+
+--- Theory of Operation: ---
+CLOCK:
+profileBegin() sets TCB1 free running at the CPU clock, counting 0 - 0xFFFF and wrapping. (TCB0 runs the control
+tick, and DxCore keeps millis() on TCB2.) A zone reads the counter when it starts and again when it ends, and
+the 16-bit difference is the number of CPU cycles in between, even across a wrap. That only goes wrong for a
+zone longer than 65535 cycles (2.7ms at 24MHz), which none of these come close to.
+
+ZONES:
+PROFILE_ZONE( zone ) at the top of a block puts a small object on the stack that reads the counter. Its
+destructor runs wherever the block is left (including early returns) and adds the cycles to the zone's entry in
+profile_zones: one more call, the total and the longest. That is two counter reads and a few adds. Zones inside
+other zones (sendData inside chSendPatch) count their time in both.
+
+REPORT:
+profileReport() prints the table (calls, average and longest cycles of each zone) and profileReset() starts
+counting again. The sketch prints it on Serial when it gets the SysEx profile request.
+
+*/
+
+#include "Arduino.h"
+
+#define PROFILE              0                                                                    // Build the profiling zones in (1) or leave them out (0)
+
+// Zones
+#define PROF_PARSE           0                                                                    // MidiParser::parse
+#define PROF_NOTE_ON         1                                                                    // YM3812::patchNoteOn (everything it takes to start a note)
+#define PROF_GET_NEXT        2                                                                    // YM3812::chGetNext
+#define PROF_SEND_PATCH      3                                                                    // YM3812::chSendPatch
+#define PROF_SEND_DATA       4                                                                    // YM3812::sendData (one register write)
+#define PROF_ZONES           5                                                                    // Number of zones
+
+struct ProfileZone{
+  uint32_t      count      = 0;                                                                   // Times the zone ran
+  uint32_t      total      = 0;                                                                   // Cycles spent in the zone
+  uint16_t      longest    = 0;                                                                   // Longest single run (cycles)
+};
+
+#if PROFILE
+  extern ProfileZone profile_zones[PROF_ZONES];                                                   // Statistics of each zone
+
+  class ProfileScope {                                                                            // Times a block (see PROFILE_ZONE)
+    private:
+      uint8_t   zone;                                                                             // Zone the time goes to
+      uint16_t  start;                                                                            // Counter when the block started
+    public:
+      ProfileScope( uint8_t z ) : zone( z ), start( TCB1.CNT ) {}
+      ~ProfileScope(){
+        uint16_t cycles = TCB1.CNT - start;                                                       // Wraps around correctly
+        ProfileZone &z = profile_zones[zone];
+        z.count++;
+        z.total += cycles;
+        if( cycles > z.longest ) z.longest = cycles;
+      }
+  };
+
+  #define PROFILE_ZONE( zone ) ProfileScope profile_scope( zone )                                 // Time the rest of the block
+
+  void profileBegin();                                                                            // Start the cycle counter
+  void profileReset();                                                                            // Clear the statistics
+  void profileReport( Print &out );                                                               // Print the statistics
+#else
+  #define PROFILE_ZONE( zone )                                                                    // Compiled out
+#endif
+
+
+#endif  // PROFILER_H
@@ -0,0 +1,227 @@
+/*
+     _____.___.  _____  ________    ______  ____________
+     \__  |   | /     \ \_____  \  /  __  \/_   \_____  \
+      /   |   |/  \ /  \  _(__  <  >      < |   |/  ____/
+      \____   /    Y    \/       \/   --   \|   /       \
+      / ______\____|__  /______  /\______  /|___\_______ \
+      \/              \/       \/        \/             \/
+            ________ __________.____    ________
+            \_____  \\______   \    |   \_____  \
+             /   |   \|     ___/    |    /  ____/
+            /    |    \    |   |    |___/       \
+            \_______  /____|   |_______ \_______ \
+                    \/                 \/       \/
+
+
+YM3182 OPL2 LIBRARY source code designed to run on the AVR128DA28.
+Copyright (C) 2022 Tyler Klein
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program. If not, see <https://www.gnu.org/licenses/>.
+
+Description:
+Standard MIDI File player. See SmfPlayer.h for the theory of operation.
+
+*/
+
+#include "Arduino.h"
+#include "SmfPlayer.h"
+
+static uint32_t readBE( const uint8_t *p, uint8_t bytes ){                     // Read a big endian number out of flash
+  uint32_t val = 0;
+  while( bytes-- ) val = (val << 8) | pgm_read_byte( p++ );
+  return( val );
+}
+
+static uint8_t dataBytes( uint8_t status ){                                    // Data bytes that follow a channel status
+  uint8_t type = status & 0xF0;
+  return( (type == MIDI_PROGRAM || type == MIDI_PRESSURE) ? 1 : 2 );
+}
+
+
+uint32_t SmfPlayer::readVar( const uint8_t *&p ){
+  uint32_t val = 0;
+  uint8_t  data;
+  for( uint8_t i = 0; i < 4; i++ ){                                            // Never more than 4 bytes
+    data = pgm_read_byte( p++ );
+    val = (val << 7) | (data & 0x7F);
+    if( !(data & 0x80) ) break;
+  }
+  return( val );
+}
+
+uint32_t SmfPlayer::tickTime( uint32_t tick ){
+  return( tempo_us + uint32_t( uint64_t( tick - tempo_tick ) * tempo / division ) );
+}
+
+bool SmfPlayer::before( uint8_t a, uint8_t b ){
+  if( tracks[a].tick != tracks[b].tick ) return( tracks[a].tick < tracks[b].tick );
+  return( a < b );
+}
+
+void SmfPlayer::heapDown( uint8_t i ){
+  while( true ){
+    uint8_t first = i;
+    uint8_t l = 2*i + 1, r = 2*i + 2;
+    if( l < heap_size && before( heap[l], heap[first] ) ) first = l;
+    if( r < heap_size && before( heap[r], heap[first] ) ) first = r;
+    if( first == i ) return;
+    uint8_t t = heap[i]; heap[i] = heap[first]; heap[first] = t;
+    i = first;
+  }
+}
+
+void SmfPlayer::nextDelta( uint8_t track ){                                    // Called for the track at the top of the heap
+  SmfTrack &t = tracks[track];
+  t.announced = false;
+  if( t.pos >= t.end ){                                                        // Out of events, so the track is done
+    heap[0] = heap[--heap_size];
+  } else {
+    t.tick += readVar( t.pos );
+  }
+  heapDown( 0 );
+}
+
+bool SmfPlayer::peek( SmfTrack &t, MidiEvent &event ){
+  const uint8_t *p = t.pos;
+  uint8_t status = pgm_read_byte( p );
+  if( status >= 0xF0 ) return( false );                                        // Meta or SysEx
+  if( status & 0x80 ) p++;
+  else status = t.status;                                                      // Running status
+  if( !status ) return( false );
+
+  event.type    = status & 0xF0;
+  event.channel = (status & 0x0F) + 1;                                         // 1 - 16, like MidiParser
+  event.data1   = pgm_read_byte( p ) & 0x7F;
+  event.data2   = (dataBytes( status ) == 2) ? pgm_read_byte( p + 1 ) & 0x7F : 0;
+  if( event.type == MIDI_NOTE_ON && event.data2 == 0 ) event.type = MIDI_NOTE_OFF; // Same as MidiParser
+  return( true );
+}
+
+
+bool SmfPlayer::begin( const uint8_t *smf, uint32_t length ){
+  song = NULL;
+  heap_size = 0;
+  if( length < 14 || readBE( smf, 4 ) != 0x4D546864 ) return( false );         // "MThd"
+  uint32_t len    = readBE( smf + 4, 4 );
+  uint16_t format = readBE( smf + 8, 2 );
+  uint16_t count  = readBE( smf + 10, 2 );
+  division        = readBE( smf + 12, 2 );
+  if( format > 1 || (division & 0x8000) || division == 0 ) return( false );    // Type 2 and SMPTE time aren't supported
+  if( len < 6 || len > length - 8 ) return( false );                           // Header runs past the end of the file
+
+  const uint8_t *p   = smf + 8 + len;                                          // First chunk after the header
+  const uint8_t *end = smf + length;
+  num_tracks = 0;
+  while( count && num_tracks < SMF_MAX_TRACKS && end - p >= 8 ){               // Until every track is found, or the file runs out
+    uint32_t id = readBE( p, 4 );
+    len = readBE( p + 4, 4 );
+    if( len > uint32_t( end - p - 8 ) ) break;                                 // Chunk runs past the end of the file
+    if( id == 0x4D54726B ){                                                    // "MTrk" (anything else gets skipped)
+      tracks[num_tracks].pos = p + 8;
+      tracks[num_tracks].end = p + 8 + len;
+      num_tracks++;
+      count--;
+    }
+    p += 8 + len;
+  }
+  song = smf;
+  song_len = length;
+  return( num_tracks > 0 );
+}
+
+void SmfPlayer::play(){
+  if( !song ) return;
+  begin( song, song_len );                                                     // Back to the start of every track
+  tempo = 500000;                                                              // 120 BPM until the file says otherwise
+  tempo_tick = tempo_us = 0;
+
+  heap_size = 0;
+  for( uint8_t i = 0; i < num_tracks; i++ ){
+    SmfTrack &t = tracks[i];
+    t.status = 0;
+    t.announced = false;
+    if( t.pos >= t.end ) continue;                                             // Empty track, nothing to play
+    t.tick = readVar( t.pos );                                                 // Delta time of the first event
+    heap[heap_size++] = i;
+  }
+  for( int8_t i = heap_size / 2 - 1; i >= 0; i-- ) heapDown( i );             // Put the heap in order
+  start_us = micros();
+}
+
+bool SmfPlayer::read( MidiEvent &event ){
+  while( heap_size ){
+    uint8_t track = heap[0];
+    SmfTrack &t = tracks[track];
+    uint32_t due = tickTime( t.tick );
+    uint32_t now = micros() - start_us;
+    if( int32_t( now - due ) < 0 ) return( false );                            // Not time yet
+
+    bool    got = false;
+    uint8_t status = pgm_read_byte( t.pos );
+    if( status == 0xFF ){                                                      // Meta event
+      uint8_t type = pgm_read_byte( t.pos + 1 );
+      t.pos += 2;
+      uint32_t len = readVar( t.pos );
+      if( type == 0x51 && len == 3 ){                                          // Set tempo
+        tempo_us   = due;
+        tempo_tick = t.tick;
+        tempo      = readBE( t.pos, 3 );
+      }
+      if( type == 0x2F ) t.pos = t.end;                                        // End of track
+      else t.pos += len;
+    }
+    else if( status == 0xF0 || status == 0xF7 ){                               // SysEx, skip it
+      t.pos++;
+      uint32_t len = readVar( t.pos );
+      t.pos += len;
+    }
+    else {
+      got = peek( t, event );
+      if( status & 0x80 ){ t.status = status; t.pos++; }
+      t.pos += dataBytes( t.status );
+    }
+    nextDelta( track );
+
+    if( got ){
+      uint32_t late = now - due;                                               // How far behind the tick grid we are
+      if( late > late_max ) late_max = late;
+      late_total += late;
+      events++;
+      return( true );
+    }
+  }
+  return( false );
+}
+
+bool SmfPlayer::lookahead( MidiEvent &event ){
+  uint32_t horizon = micros() - start_us + SMF_LOOKAHEAD;
+  for( uint8_t i = 0; i < heap_size; i++ ){
+    SmfTrack &t = tracks[ heap[i] ];
+    if( t.announced ) continue;
+    if( int32_t( horizon - tickTime( t.tick ) ) < 0 ) continue;                // Not coming up yet
+    t.announced = true;
+    if( peek( t, event ) && event.type == MIDI_NOTE_ON ) return( true );
+  }
+  return( false );
+}
+
+void SmfPlayer::report( Print &out ){
+  out.print( "Song events: " );
+  out.print( events );
+  out.print( " late max: " );
+  out.print( late_max );
+  out.print( "us avg: " );
+  out.print( events ? late_total / events : 0 );
+  out.println( "us" );
+}
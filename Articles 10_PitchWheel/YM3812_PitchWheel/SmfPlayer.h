@@ -0,0 +1,124 @@
+#ifndef SMFPLAYER_H
+#define SMFPLAYER_H
+
+/*
+     _____.___.  _____  ________    ______  ____________
+     \__  |   | /     \ \_____  \  /  __  \/_   \_____  \
+      /   |   |/  \ /  \  _(__  <  >      < |   |/  ____/
+      \____   /    Y    \/       \/   --   \|   /       \
+      / ______\____|__  /______  /\______  /|___\_______ \
+      \/              \/       \/        \/             \/
+            ________ __________.____    ________
+            \_____  \\______   \    |   \_____  \
+             /   |   \|     ___/    |    /  ____/
+            /    |    \    |   |    |___/       \
+            \_______  /____|   |_______ \_______ \
+                    \/                 \/       \/
+
+
+YM3182 OPL2 LIBRARY source code designed to run on the AVR128DA28.
+Copyright (C) 2022 Tyler Klein
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program. If not, see <https://www.gnu.org/licenses/>.
+
+--- Description: ---
+Plays a Standard MIDI File (type 0 or 1) stored in PROGMEM, so the module can play songs on its own. The player
+hands out the same MidiEvent structures as MidiParser, so the sketch sends them through the same handlers as live
+MIDI. Nothing is decoded ahead into RAM; every track is read straight out of flash as it plays.
+
+
+--- Theory of Operation: ---
+TRACKS:
+Each track keeps a read position in flash, its running status and the absolute tick of its next event. To play
+the tracks together, the track numbers sit in a small binary heap ordered by the tick of their next event (ties
+go to the lower track, so tempo changes on track 0 come first). The track at the top of the heap always has the
+next event of the song. After its event is read, the next delta time is added to the track's tick and the track
+sinks back down the heap. A track that reaches its end leaves the heap, and the song is over once the heap is
+empty. With at most SMF_MAX_TRACKS tracks, that is only a few comparisons per event. begin() is given the
+length of the file and never looks past it: a chunk that claims to run past the end stops the search for tracks
+there, and an empty track never joins the heap.
+
+TIMING:
+Tick times are turned into microseconds from the start of the song. Tempo changes (meta event 51) are applied
+when they come up, by remembering the time and tick of the last change; everything after it is counted from
+there with the new tempo. read() only hands out an event once its time has come, so the sketch just calls it
+from loop() like MidiParser::read. Only files with ticks per quarter note are supported (not SMPTE time).
+
+LOOKAHEAD:
+Every track's next event is already known, so lookahead() can look at them to see which notes are about to
+start. It returns each note on that is due within SMF_LOOKAHEAD microseconds, once, so the sketch can send the
+patch to a channel ahead of time (see YM3812::patchPreload) and the note starts right on time.
+
+JITTER:
+Every event handed out is checked against the time it was due, and the lateness is kept (worst case and total)
+so report() can show how closely playback follows the file's tick grid.
+
+*/
+
+#include "Arduino.h"
+#include "MidiParser.h"
+
+#define SMF_MAX_TRACKS       8                                                                    // Most tracks a file can have (extra tracks are ignored)
+#define SMF_LOOKAHEAD        20000                                                                // How far ahead lookahead() looks for notes (microseconds)
+
+struct SmfTrack{
+  const uint8_t *pos       = NULL;                                                                // Next byte of the track in flash (the next event, once its delta time is read)
+  const uint8_t *end       = NULL;                                                                // End of the track
+  uint32_t      tick       = 0;                                                                   // Absolute tick of the next event
+  uint8_t       status     = 0;                                                                   // Running status
+  bool          announced  = false;                                                               // The next event was already handed out by lookahead()
+};
+
+
+class SmfPlayer {                                                                                 // SmfPlayer Class
+  private:
+    const uint8_t *song      = NULL;                                                              // The file in flash
+    uint32_t    song_len     = 0;                                                                 // Length of the file (bytes)
+    uint16_t    division     = 96;                                                                // Ticks per quarter note
+    uint8_t     num_tracks   = 0;                                                                 // Tracks in the file
+    SmfTrack    tracks[SMF_MAX_TRACKS];                                                           // Read state of each track
+    uint8_t     heap[SMF_MAX_TRACKS];                                                             // Tracks still playing, ordered by their next event
+    uint8_t     heap_size    = 0;                                                                 // Tracks in the heap
+
+    uint32_t    start_us     = 0;                                                                 // micros() when the song started
+    uint32_t    tempo        = 500000;                                                            // Microseconds per quarter note
+    uint32_t    tempo_tick   = 0;                                                                 // Tick of the last tempo change
+    uint32_t    tempo_us     = 0;                                                                 // Song time of the last tempo change
+
+    uint32_t    late_max     = 0;                                                                 // Latest an event has been handed out (microseconds)
+    uint32_t    late_total   = 0;                                                                 // Total lateness (for the average)
+    uint32_t    events       = 0;                                                                 // Events handed out
+
+    uint32_t    readVar( const uint8_t *&p );                                                     // Read a variable length number
+    uint32_t    tickTime( uint32_t tick );                                                        // Song time of a tick (microseconds)
+    bool        before( uint8_t a, uint8_t b );                                                   // Track a's next event comes before track b's
+    void        heapDown( uint8_t i );                                                            // Move a heap entry down to where it belongs
+    void        nextDelta( uint8_t track );                                                       // Read the delta time of a track's next event (or take it out of the heap)
+    bool        peek( SmfTrack &t, MidiEvent &event );                                            // Decode a track's next channel event without reading past it
+
+  public:
+    bool        begin( const uint8_t *smf, uint32_t length );                                     // Load a file from PROGMEM (false if it isn't a type 0/1 SMF with ticks per quarter)
+    void        play();                                                                           // Start the song from the beginning
+    void        stop(){ heap_size = 0; }                                                          // Stop handing out events
+    bool        playing(){ return( heap_size > 0 ); }                                             // Events are left to play
+    bool        read( MidiEvent &event );                                                         // Next event that is due, false if there isn't one yet
+    bool        lookahead( MidiEvent &event );                                                    // Next note on due within SMF_LOOKAHEAD that hasn't been announced
+    uint32_t    getLateMax(){ return( late_max ); }                                               // Latest an event has been handed out (microseconds)
+    uint32_t    getLateTotal(){ return( late_total ); }                                           // Total lateness of every event (microseconds)
+    uint32_t    getEvents(){ return( events ); }                                                  // Events handed out
+    void        report( Print &out );                                                             // Print the timing statistics
+};
+
+
+#endif  // SMFPLAYER_H
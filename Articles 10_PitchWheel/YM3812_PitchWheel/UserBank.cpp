@@ -0,0 +1,150 @@
+/*
+     _____.___.  _____  ________    ______  ____________
+     \__  |   | /     \ \_____  \  /  __  \/_   \_____  \
+      /   |   |/  \ /  \  _(__  <  >      < |   |/  ____/
+      \____   /    Y    \/       \/   --   \|   /       \
+      / ______\____|__  /______  /\______  /|___\_______ \
+      \/              \/       \/        \/             \/
+            ________ __________.____    ________
+            \_____  \\______   \    |   \_____  \
+             /   |   \|     ___/    |    /  ____/
+            /    |    \    |   |    |___/       \
+            \_______  /____|   |_______ \_______ \
+                    \/                 \/       \/
+
+
+YM3182 OPL2 LIBRARY source code designed to run on the AVR128DA28.
+Copyright (C) 2022 Tyler Klein
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program. If not, see <https://www.gnu.org/licenses/>.
+
+Description:
+User patch bank stored in flash. See UserBank.h for the theory of operation.
+
+*/
+
+#include "Arduino.h"
+#include "UserBank.h"
+#include <Flash.h>
+
+const uint8_t user_bank[USER_PAGE_SIZE * USER_BANK_PAGES] __attribute__((aligned(USER_PAGE_SIZE))) PROGMEM = {}; // Flash set aside for user patches
+
+
+const uint8_t *UserBank::slotAddr( uint8_t slot ){
+  return( user_bank + (slot / USER_SLOTS_PER_PAGE) * USER_PAGE_SIZE + (slot % USER_SLOTS_PER_PAGE) * USER_SLOT_SIZE );
+}
+
+uint8_t *UserBank::slotHeader( uint8_t slot ){
+  if( slot / USER_SLOTS_PER_PAGE != buf_page ) return( NULL );
+  return( page_buf + (slot % USER_SLOTS_PER_PAGE) * USER_SLOT_SIZE );
+}
+
+bool UserBank::slotUsed( uint8_t slot, uint8_t *program ){
+  uint8_t *buf = slotHeader( slot );
+  const uint8_t *addr = slotAddr( slot );
+  uint8_t used = buf ? buf[0] : pgm_read_byte( addr );                         // Buffered changes win over what is in flash
+  *program     = buf ? buf[1] : pgm_read_byte( addr + 1 );
+  return( used == USER_SLOT_USED && *program < USER_PROGRAMS );
+}
+
+bool UserBank::loadPage( uint8_t page ){
+  if( page == buf_page ) return( true );                                       // Already there
+  if( dirty ) return( false );                                                 // Can't throw away unwritten changes
+  memcpy_P( page_buf, user_bank + page * USER_PAGE_SIZE, USER_PAGE_SIZE );
+  buf_page = page;
+  return( true );
+}
+
+void UserBank::indexPage( uint8_t page ){
+  uint8_t first = page * USER_SLOTS_PER_PAGE;
+  uint8_t program;
+
+  for( uint8_t p = 0; p < USER_PROGRAMS; p++ ){                                // Forget what the page used to hold
+    if( index[p] >= first && index[p] < first + USER_SLOTS_PER_PAGE ) index[p] = 0xFF;
+  }
+  for( uint8_t slot = first; slot < first + USER_SLOTS_PER_PAGE; slot++ ){
+    if( slotUsed( slot, &program ) ) index[program] = slot;
+  }
+}
+
+
+void UserBank::begin(){
+  memset( index, 0xFF, sizeof( index ) );
+  buf_page = 0xFF;                                                             // Nothing buffered, so indexPage reads the flash
+  dirty = false;
+  for( uint8_t page = 0; page < USER_BANK_PAGES; page++ ) indexPage( page );
+  writable = ( Flash.checkWritable() == FLASHWRITE_OK );
+}
+
+YM_Patch UserBank::patch( uint8_t program ){
+  if( program >= USER_PROGRAMS || index[program] == 0xFF ) return( YM_Patch() );
+  return( YM_Patch( slotAddr( index[program] ) + 2 ) );                        // Read from flash like any other PROGMEM patch
+}
+
+bool UserBank::store( uint8_t program, YM_Patch patch ){
+  uint8_t slot = 0xFF, empty = 0xFF, p;
+  if( !writable || program >= USER_PROGRAMS || !patch.data ) return( false );
+
+  for( uint8_t s = 0; s < USER_BANK_SLOTS && slot == 0xFF; s++ ){              // Find the program's slot (including staged ones)
+    if( slotUsed( s, &p ) ){ if( p == program ) slot = s; }
+    else if( empty == 0xFF ) empty = s;                                        // or remember the first free one
+  }
+  if( slot == 0xFF ) slot = empty;
+  if( slot == 0xFF ) return( false );                                          // Bank is full
+  if( !loadPage( slot / USER_SLOTS_PER_PAGE ) ) return( false );               // Another page is waiting to be written
+
+  uint8_t *dst = slotHeader( slot );
+  dst[0] = USER_SLOT_USED;
+  dst[1] = program;
+  for( uint8_t i = 0; i < PATCH_SIZE; i++ ) dst[2+i] = patch[i];               // Copy (and unpack) the patch
+  dirty = true;
+  return( true );
+}
+
+bool UserBank::flush(){
+  if( !dirty ) return( true );
+
+  uint32_t *cycles = (uint32_t *)( page_buf + USER_PAGE_SIZE - 4 );            // Write count lives at the end of the page
+  uint32_t  old    = *cycles;
+  *cycles = ( old == 0xFFFFFFFF ) ? 1 : old + 1;                               // (an erased page counts as never written)
+
+  uint32_t addr = (uint32_t)(uintptr_t)( user_bank + buf_page * USER_PAGE_SIZE ); // Flash address of the page
+  if( Flash.erasePage( addr ) != FLASHWRITE_OK ||
+      Flash.writeWords( addr, (uint16_t *)page_buf, USER_PAGE_SIZE / 2 ) != FLASHWRITE_OK ){
+    *cycles = old;                                                             // Only a write that made it counts
+    uint8_t page = buf_page;
+    buf_page = 0xFF;                                                           // The page may be half erased, so index what
+    indexPage( page );                                                         // is really in flash rather than the buffer
+    if( ++failures < USER_FLUSH_TRIES ){
+      buf_page = page;                                                         // Keep the changes for another try
+    } else {
+      dirty = false;                                                           // Give up on them
+      failures = 0;
+      lost++;
+    }
+    return( false );
+  }
+
+  dirty = false;
+  failures = 0;
+  writes++;
+  indexPage( buf_page );                                                       // New patches can be loaded now
+  return( true );
+}
+
+uint32_t UserBank::getPageCycles( uint8_t page ){
+  if( page >= USER_BANK_PAGES ) return( 0 );
+  uint32_t cycles = pgm_read_dword( user_bank + page * USER_PAGE_SIZE + USER_PAGE_SIZE - 4 );
+  return( cycles == 0xFFFFFFFF ? 0 : cycles );
+}
@@ -0,0 +1,112 @@
+#ifndef USERBANK_H
+#define USERBANK_H
+
+/*
+     _____.___.  _____  ________    ______  ____________
+     \__  |   | /     \ \_____  \  /  __  \/_   \_____  \
+      /   |   |/  \ /  \  _(__  <  >      < |   |/  ____/
+      \____   /    Y    \/       \/   --   \|   /       \
+      / ______\____|__  /______  /\______  /|___\_______ \
+      \/              \/       \/        \/             \/
+            ________ __________.____    ________
+            \_____  \\______   \    |   \_____  \
+             /   |   \|     ___/    |    /  ____/
+            /    |    \    |   |    |___/       \
+            \_______  /____|   |_______ \_______ \
+                    \/                 \/       \/
+
+
+YM3182 OPL2 LIBRARY source code designed to run on the AVR128DA28.
+Copyright (C) 2022 Tyler Klein
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program. If not, see <https://www.gnu.org/licenses/>.
+
+--- Description: ---
+A bank of user patches kept in the AVR128DA's own flash, so patches that were edited or uploaded survive a power
+cycle. Stored patches are read back with the same PROGMEM reads as the factory bank (PATCH_TYPE_FLASH handles),
+so nothing else needs to know where a patch came from. Writing uses DxCore's Flash library, which needs flash
+writing enabled in the board options (or the Optiboot bootloader).
+
+
+--- Theory of Operation: ---
+LAYOUT:
+The bank is a page aligned block of PROGMEM (user_bank), USER_BANK_PAGES pages of USER_PAGE_SIZE bytes. Each
+page holds USER_SLOTS_PER_PAGE slots, and each slot is a 2 byte header (USER_SLOT_USED and the program number)
+followed by a generic PATCH_SIZE patch. The last 4 bytes of every page count how many times it has been written.
+The array starts out as zeros, so reflashing the sketch clears the bank.
+
+INDEX:
+begin() reads the header of every slot once and builds a small RAM index from program number to slot, so
+finding a user patch on a program change is a single lookup.
+
+WRITING:
+Flash can only be erased a page at a time, and the CPU stops while that happens, which would stall anything
+timing sensitive. So store() never touches the flash. It copies the page into a RAM page buffer (if it isn't
+there already) and changes the slot in the buffer. flush() erases and writes the page later, when the sketch
+decides it is safe (no notes playing, see userBankService). Several stores to the same page go out as one
+write. A store to a different page while the buffer still holds unwritten changes returns false, and should be
+tried again after the flush. The index only changes once the page has been written, so until then program
+changes still load the old version.
+
+A flush that fails leaves the page in an unknown state (the erase may have worked and the write not), so the
+index is rebuilt from what is really in flash, and the changes stay in the buffer for another try. The write
+count only goes up when the page made it. After USER_FLUSH_TRIES failures in a row the changes are dropped, so
+a worn out page can't keep the bank from taking stores for other pages.
+
+*/
+
+#include "Arduino.h"
+#include "YMDefs.h"
+
+#define USER_PAGE_SIZE       512                                                                  // Flash page size of the AVR128DA (bytes)
+#define USER_BANK_PAGES      4                                                                    // Pages of flash set aside for user patches
+#define USER_SLOT_SIZE       (PATCH_SIZE + 2)                                                     // Header (used marker and program number) plus the patch
+#define USER_SLOTS_PER_PAGE  ((USER_PAGE_SIZE - 4) / USER_SLOT_SIZE)                              // Slots that fit in a page (leaving room for the write count)
+#define USER_BANK_SLOTS      (USER_SLOTS_PER_PAGE * USER_BANK_PAGES)                              // Total number of user patches
+#define USER_SLOT_USED       0xA5                                                                 // First header byte of a slot that holds a patch
+#define USER_PROGRAMS        128                                                                  // Program numbers that can have a user patch
+#define USER_FLUSH_TRIES     3                                                                    // Failed flushes in a row before the buffered changes are dropped
+
+
+class UserBank {                                                                                  // UserBank Class
+  private:
+    uint8_t     index[USER_PROGRAMS];                                                             // Slot of each program's user patch (0xFF = none)
+    uint8_t     page_buf[USER_PAGE_SIZE];                                                         // RAM copy of the page being changed
+    uint8_t     buf_page     = 0xFF;                                                              // Page in page_buf (0xFF = none)
+    bool        dirty        = false;                                                             // page_buf has changes that aren't in flash yet
+    bool        writable     = false;                                                             // Flash writing is available
+    uint32_t    writes       = 0;                                                                 // Number of page writes since power on
+    uint8_t     failures     = 0;                                                                 // Failed flushes in a row
+    uint32_t    lost         = 0;                                                                 // Pages of changes dropped after USER_FLUSH_TRIES failures
+
+    const uint8_t *slotAddr( uint8_t slot );                                                      // Where a slot lives in flash
+    uint8_t    *slotHeader( uint8_t slot );                                                       // Slot header from page_buf, or NULL if the slot isn't buffered
+    bool        slotUsed( uint8_t slot, uint8_t *program );                                       // Whether a slot holds a patch (buffered changes included)
+    bool        loadPage( uint8_t page );                                                         // Get a page into page_buf (false if it holds another page's changes)
+    void        indexPage( uint8_t page );                                                        // Rebuild the index entries for a page
+
+  public:
+    void        begin();                                                                          // Build the index (call once at startup)
+    YM_Patch    patch( uint8_t program );                                                         // Handle to a program's user patch (empty handle if there isn't one)
+    bool        store( uint8_t program, YM_Patch patch );                                         // Stage a patch for a program (written by flush)
+    bool        pending(){ return( dirty ); }                                                     // Changes are waiting for flush
+    bool        flush();                                                                          // Erase and write the buffered page (only call when a stall is ok)
+    uint32_t    getWrites(){ return( writes ); }                                                  // Page writes since power on
+    uint8_t     getFailures(){ return( failures ); }                                              // Failed flushes since the last one that worked
+    uint32_t    getLost(){ return( lost ); }                                                      // Pages of changes that never made it to flash
+    uint32_t    getPageCycles( uint8_t page );                                                    // Lifetime write count of a page
+};
+
+
+#endif  // USERBANK_H
@@ -38,6 +38,7 @@ direct manipulation of the chip's registers so you can build cool things like Eu
 #include "Arduino.h"
 #include <SPI.h>
 #include "YM3812.h"
+#include "Profiler.h"
 
 
 //Port Bits defined for control bus:
@@ -47,21 +48,139 @@ direct manipulation of the chip's registers so you can build cool things like Eu
 #define YM_LATCH 0b00001000                                                    // Pin 3, Port D - Output Latch
 #define YM_CS    0b00010000                                                    // Pin 4, Port D - Left YM3812 Chip Select
 
-// Optional debug light shows when information gets written to the YM3812
-#define DATA_LED 0b10000000                                                    // We can use this to see activity when data is being sent
+// Optional debug light shows how busy the bus to the YM3812 is (see ledUpdate)
+#define DATA_LED 0b10000000                                                    // Pin 7, Port D - Bus load meter
+
+// Frequency Scale
+// F-Numbers for each midi note. Notes below 18 are all in block 0, above that the last 12 entries repeat every block
+static const uint16_t FRQ_SCALE[31] PROGMEM = {
+  0x0AD, 0x0B7, 0x0C2, 0x0CD, 0x0D9, 0x0E6, 0x0F4, 0x102, 0x112, 0x122, 0x133, 0x145,
+  0x159, 0x16D, 0x183, 0x19A, 0x1B2, 0x1CC, 0x1E8, 0x205, 0x224, 0x244, 0x267, 0x28B,
+  0x2B2, 0x2DB, 0x306, 0x334, 0x365, 0x399, 0x3CF
+};
+
+// Velocity curve tables, indexed by curve and then by velocity. See VEL_CURVE_* in YMDefs.h
+static const uint8_t VEL_CURVE_TABLE[VEL_CURVES][128] PROGMEM = {
+  { // Linear: velocity passes straight through
+      0,  1,  2,  3,  4,  5,  6,  7,  8,  9, 10, 11, 12, 13, 14, 15,
+     16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31,
+     32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47,
+     48, 49, 50, 51, 52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 62, 63,
+     64, 65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79,
+     80, 81, 82, 83, 84, 85, 86, 87, 88, 89, 90, 91, 92, 93, 94, 95,
+     96, 97, 98, 99,100,101,102,103,104,105,106,107,108,109,110,111,
+    112,113,114,115,116,117,118,119,120,121,122,123,124,125,126,127,
+  },
+  { // Exponential: softer response, more of the range spent on loud notes
+      0,  0,  0,  0,  0,  0,  0,  0,  1,  1,  1,  1,  1,  1,  2,  2,
+      2,  2,  3,  3,  3,  3,  4,  4,  5,  5,  5,  6,  6,  7,  7,  8,
+      8,  9,  9, 10, 10, 11, 11, 12, 13, 13, 14, 15, 15, 16, 17, 17,
+     18, 19, 20, 20, 21, 22, 23, 24, 25, 26, 26, 27, 28, 29, 30, 31,
+     32, 33, 34, 35, 36, 37, 39, 40, 41, 42, 43, 44, 45, 47, 48, 49,
+     50, 52, 53, 54, 56, 57, 58, 60, 61, 62, 64, 65, 67, 68, 70, 71,
+     73, 74, 76, 77, 79, 80, 82, 84, 85, 87, 88, 90, 92, 94, 95, 97,
+     99,101,102,104,106,108,110,112,113,115,117,119,121,123,125,127,
+  },
+  { // Logarithmic: louder response, quiet notes come up quickly
+      0, 18, 29, 36, 42, 47, 51, 54, 58, 60, 63, 65, 67, 69, 71, 73,
+     74, 76, 77, 78, 80, 81, 82, 83, 84, 85, 86, 87, 88, 89, 90, 91,
+     92, 92, 93, 94, 95, 95, 96, 97, 97, 98, 98, 99,100,100,101,101,
+    102,102,103,103,104,104,105,105,106,106,107,107,108,108,108,109,
+    109,110,110,110,111,111,112,112,112,113,113,113,114,114,114,115,
+    115,115,116,116,116,117,117,117,117,118,118,118,119,119,119,119,
+    120,120,120,121,121,121,121,122,122,122,122,123,123,123,123,124,
+    124,124,124,124,125,125,125,125,126,126,126,126,126,127,127,127,
+  },
+  { // Fixed: velocity is ignored and every note plays at full level
+    127,127,127,127,127,127,127,127,127,127,127,127,127,127,127,127,
+    127,127,127,127,127,127,127,127,127,127,127,127,127,127,127,127,
+    127,127,127,127,127,127,127,127,127,127,127,127,127,127,127,127,
+    127,127,127,127,127,127,127,127,127,127,127,127,127,127,127,127,
+    127,127,127,127,127,127,127,127,127,127,127,127,127,127,127,127,
+    127,127,127,127,127,127,127,127,127,127,127,127,127,127,127,127,
+    127,127,127,127,127,127,127,127,127,127,127,127,127,127,127,127,
+    127,127,127,127,127,127,127,127,127,127,127,127,127,127,127,127,
+  },
+};
+
+
+// Attenuation (in 0.75dB level steps) for a volume or expression controller value. Follows the General MIDI
+// curve of 40 * log10( value / 127 ) dB, so volume and expression can simply be added together.
+static const uint8_t VOLUME_TABLE[128] PROGMEM = {
+     63, 63, 63, 63, 63, 63, 63, 63, 63, 61, 59, 57, 55, 53, 51, 49,
+     48, 47, 45, 44, 43, 42, 41, 40, 39, 38, 37, 36, 35, 34, 33, 33,
+     32, 31, 31, 30, 29, 29, 28, 27, 27, 26, 26, 25, 25, 24, 24, 23,
+     23, 22, 22, 21, 21, 20, 20, 19, 19, 19, 18, 18, 17, 17, 17, 16,
+     16, 16, 15, 15, 14, 14, 14, 13, 13, 13, 13, 12, 12, 12, 11, 11,
+     11, 10, 10, 10, 10,  9,  9,  9,  8,  8,  8,  8,  7,  7,  7,  7,
+      6,  6,  6,  6,  6,  5,  5,  5,  5,  4,  4,  4,  4,  4,  3,  3,
+      3,  3,  3,  2,  2,  2,  2,  2,  1,  1,  1,  1,  1,  0,  0,  0,
+};
+
+
+// LFO waveform tables, indexed by waveform and then by the top 6 bits of the LFO phase. See LFO_* in YMDefs.h
+static const int8_t LFO_WAVE[LFO_WAVES][64] PROGMEM = {
+  { // Sine
+       0,  12,  25,  37,  49,  60,  71,  81,  90,  98, 106, 112, 117, 122, 125, 126,
+     127, 126, 125, 122, 117, 112, 106,  98,  90,  81,  71,  60,  49,  37,  25,  12,
+       0, -12, -25, -37, -49, -60, -71, -81, -90, -98,-106,-112,-117,-122,-125,-126,
+    -127,-126,-125,-122,-117,-112,-106, -98, -90, -81, -71, -60, -49, -37, -25, -12,
+  },
+  { // Triangle
+       0,   8,  16,  24,  32,  40,  48,  56,  64,  72,  80,  88,  96, 104, 112, 120,
+     127, 120, 112, 104,  96,  88,  80,  72,  64,  56,  48,  40,  32,  24,  16,   8,
+       0,  -8, -16, -24, -32, -40, -48, -56, -64, -72, -80, -88, -96,-104,-112,-120,
+    -127,-120,-112,-104, -96, -88, -80, -72, -64, -56, -48, -40, -32, -24, -16,  -8,
+  },
+  { // Square
+     127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
+     127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
+    -127,-127,-127,-127,-127,-127,-127,-127,-127,-127,-127,-127,-127,-127,-127,-127,
+    -127,-127,-127,-127,-127,-127,-127,-127,-127,-127,-127,-127,-127,-127,-127,-127,
+  },
+  { // Saw (falling)
+     127, 123, 119, 115, 111, 107, 103,  99,  95,  91,  87,  83,  79,  75,  71,  67,
+      62,  58,  54,  50,  46,  42,  38,  34,  30,  26,  22,  18,  14,  10,   6,   2,
+      -2,  -6, -10, -14, -18, -22, -26, -30, -34, -38, -42, -46, -50, -54, -58, -62,
+     -67, -71, -75, -79, -83, -87, -91, -95, -99,-103,-107,-111,-115,-119,-123,-127,
+  },
+};
+
+
+// LFO phase change per control tick for an lfo_rate value. The LFO runs at about (rate^2 + 6) / 768 Hz, which
+// covers roughly 0.01Hz up to 21Hz, with most of the range spent on the useful vibrato speeds.
+static uint16_t lfoIncrement( uint8_t rate, uint16_t controlRate ){
+  return( (uint32_t(rate) * rate + 6) * 256 / (3UL * controlRate) );
+}
+
 
 /**************
 * Constructor *
 **************/
 
 YM3812::YM3812(){                                                              // Constructor
+  setControlRate( control_rate );                                              // Work out the default LFO speeds
+}
+
+
+void YM3812::setControlRate(uint16_t hz){                                      // Rate (Hz) of the control tick (see ControlTick.h)
+  if( hz ) control_rate = hz;                                                  // Used to turn envelope times into a number of ticks
+  for( uint8_t i = 0; i < YM_MAX_INSTRUMENTS; i++ ){                           // LFO speeds depend on the tick rate too
+    inst_states[i].lfo_inc = lfoIncrement( inst_states[i].lfo_rate, control_rate );
+  }
+}
+
+void YM3812::controlTick(){                                                    // Advance the control clock
+  control_ticks++;                                                             // Used by the envelopes to catch up on missed ticks
+  for( uint8_t i = 0; i < YM_MAX_INSTRUMENTS; i++ ){                           // Move every instrument's LFO along
+    inst_states[i].lfo_phase += inst_states[i].lfo_inc;
+  }
 }
 
 
 void YM3812::setBendRange(uint8_t wheelNoteRange){                             // Pass the number of notes in the range (even numbers please!)
   if( wheelNoteRange < 2 ) return;
-  bend_note_offset = wheelNoteRange >> 1;                                      // Divide wheel range by 2 to get the offset
-  bend_note_size   = PITCH_WHEEL_RANGE / (wheelNoteRange & 0xFFFE);            // Divide full range by number of notes (force to be even number of notes)
+  bend_note_offset = wheelNoteRange >> 1;                                      // Divide wheel range by 2 to get the offset (force to be even number of notes)
 }
 
 
@@ -70,152 +189,932 @@ void YM3812::setBendRange(uint8_t wheelNoteRange){                             /
 * Patch Functions       *
 ************************/
 
-void YM3812::patchNoteOn( PatchArr &patch, uint8_t midiNote, uint8_t velocity, uint16_t pitchBend ){
-  last_channel = chGetNext();
-  channel_states[ last_channel ].pPatch  = &patch;                             // Store pointer to the patch
-  channel_states[ last_channel ].midi_note  = midiNote;                        // Store midi note associated with the channel
-  channel_states[ last_channel ].velocity = velocity;                          // Store velocity associated with the channel
-  channel_states[ last_channel ].note_state = true;                            // Indicate that the note is turned on
-  channel_states[ last_channel ].state_changed = millis();                     // save the time that the note was turned on
+// patchNoteOn Theory of Operation:
+// Most patches play on a single channel. Patches with a 2x2OP configuration carry a second voice that has to be
+// played on a channel of its own, so we grab two channels and link them together. The pair is treated as one
+// unit from then on: both get the same note, velocity and pitch bend, and if either of them gets stolen by a new
+// note, the other one is released too (see chGetNext).
+
+void YM3812::patchNoteOn( YM_Patch patch, uint8_t midiNote, uint8_t velocity, uint16_t pitchBend, uint8_t inst ){
+  PROFILE_ZONE( PROF_NOTE_ON );
+  uint8_t voices = ((patch[PATCH_PROC_CONF] & 0x0F) == CONF_2x2OP) ? 2 : 1;   // Number of channels the patch needs
+  uint8_t ch[2];
+  bool    mono = inst < YM_MAX_INSTRUMENTS && inst_states[inst].mono;
+
+  if( mono && monoNoteOn( inst, patch, midiNote ) ) return;                    // Mono voice moved to the note without retriggering
+
+  if( !mono && inst < YM_MAX_INSTRUMENTS && inst_states[inst].glide_on ){      // With portamento on, slide the newest note on the instrument
+    uint8_t glide_ch = 0xFF;                                                   // over to the new one rather than starting another
+    for( uint8_t i = 0; i < num_channels; i++ ){
+      YM_Channel &state = channel_states[i];
+      if( state.inst != inst || !state.note_state || state.patch != patch || state.voice ) continue;
+      if( glide_ch == 0xFF || state.state_changed >= channel_states[glide_ch].state_changed ) glide_ch = i;
+    }
+    if( glide_ch != 0xFF ){
+      chGlideTo( glide_ch, midiNote );
+      return;
+    }
+  }
 
-  if( pitchBend == 0x2000 ){                                                   // When not in use, do this the easy way
-    channel_states[ last_channel ].bend_note = 0;                              // no pitch bend, so bend_note is just zero
-    channel_states[ last_channel ].bend_rem = 0;                               // no pitch bend, so bend_rem is just zero
-  } else {                                                                     // When pitchBend is set, calculate the new values
-    channel_states[ last_channel ].bend_note = (pitchBend / bend_note_size) - bend_note_offset; // Calculate the whole number of semitones to bend
-    channel_states[ last_channel ].bend_rem = pitchBend % bend_note_size;      // Calculate the remaining portion of a semitone to bend
+  uint8_t mono_ch = mono ? inst_states[inst].mono_ch : 0xFF;
+  if( mono_ch < num_channels && channel_states[mono_ch].inst == inst ){        // Mono voices keep reusing the same channel
+    ch[0] = mono_ch;
+    chUnlink( ch[0] );
+  } else {
+    ch[0] = chGetNext( 0xFF, inst, patch );                                    // Channel for the first voice
   }
+  if( voices == 2 ) ch[1] = chGetNext( ch[0], inst );                          // And a different one for the second
+
+  for( uint8_t v = 0; v < voices; v++ ){
+    YM_Channel &state = channel_states[ ch[v] ];
+    state.preloaded = state.preloaded && state.patch == patch && v == 0;       // Only counts if it was preloaded with this patch
+    state.patch = patch;                                                       // Store handle to the patch
+    state.midi_note  = midiNote;                                               // Store midi note associated with the channel
+    state.velocity = velocity & 0x7F;                                          // Store velocity associated with the channel
+    chSetNoteState( ch[v], false );                                            // Stolen note no longer counts against its instrument
+    state.inst = inst < YM_MAX_INSTRUMENTS ? inst : 0;                         // Store the instrument the note belongs to
+    chSetNoteState( ch[v], true );                                             // Indicate that the note is turned on
+    state.state_changed = millis();                                            // save the time that the note was turned on
+    state.bend = bendOffset( pitchBend );                                      // Store the pitch bend as a fixed point semitone offset
+    state.voice = v;                                                           // Which of the patch's voices the channel plays
+    state.link = (voices == 2) ? ch[v^1] : 0xFF;                               // Link the pair together (if there is one)
+    state.detune = v ? int8_t( patch[PATCH_OP_SETTINGS*2 + PATCH_DETUNE_FINE] ) - 64 : 0; // Second voice picks up the patch's fine tune
+    state.peg = pegLevel( patch[PATCH_PEG_INIT_LEVEL] );                       // Pitch envelope starts at its initial level
+    pegMoveTo( ch[v], 0, patch[PATCH_PEG_ATTACK] );                            // and works its way back to the note
+    state.glide = state.glide_step = 0;                                        // New notes start right on pitch
+    lfoStart( ch[v] );                                                         // LFO fades in from nothing
+  }
+
+  if( mono ) inst_states[inst].mono_ch = ch[0];                               // Remember where the mono voice lives
 
-  chPlayNote( last_channel );                                                  // Play the note on the correct YM3812 channel
+  last_channel = ch[0];
+  chPlayNote( last_channel );                                                  // Play the note on the correct YM3812 channel(s)
 }
 
 
-void YM3812::patchNoteOn( PatchArr &patch, uint8_t midiNote, uint8_t velocity ){ // If pitch bend value not passed, assume a pitch bend in the middle
+void YM3812::patchNoteOn( YM_Patch patch, uint8_t midiNote, uint8_t velocity ){ // If pitch bend value not passed, assume a pitch bend in the middle
   patchNoteOn( patch, midiNote, velocity, 0x2000 ); 
 }
 
 
-void YM3812::patchNoteOff( PatchArr &patch, uint8_t midiNote ){
+// patchPreload Theory of Operation:
+// Sending a patch takes 11 register writes, and they all happen between key off and key on, so a note can only
+// start once they are done. When we know a note is coming (a song being played, say) the patch can go out ahead
+// of time instead. patchPreload sends it to the channel that has been off the longest and flags the channel.
+// chGetNext then hands that channel to the first note using the patch, and chPlayNote only has to send the
+// operator levels (they depend on the velocity). Only the first voice of a 2x2OP patch gets preloaded. Channels
+// that already hold a preload are left alone, so a few notes can be lined up at once. Only channels that have
+// gone quiet (chIdle) are used, since new registers would cut off or colour a release tail. The flag is dropped
+// as soon as the channel's registers stop matching the patch (chSendPatch with another patch, a field edit, or
+// the patch data being reused, see patchForget).
+
+void YM3812::patchPreload( YM_Patch patch ){
+  uint8_t ch = 0xFF;
+  for( uint8_t i = 0; i < num_channels; i++ ){
+    YM_Channel &state = channel_states[i];
+    if( state.preloaded ){
+      if( state.patch == patch ) return;                                       // Already waiting for the note
+      continue;                                                                // Waiting for some other note
+    }
+    if( !chIdle( i ) ) continue;                                               // Only channels that have gone quiet
+    if( ch == 0xFF || state.state_changed < channel_states[ch].state_changed ) ch = i; // Off the longest
+  }
+  if( ch == 0xFF ) return;                                                     // Everything is busy (or still releasing)
+
+  YM_Channel &state = channel_states[ch];
+  chUnlink( ch );
+  state.patch = patch;
+  state.voice = 0;
+  state.preloaded = true;
+  if( state.inst >= YM_MAX_INSTRUMENTS ) state.inst = 0;                       // Never played yet, but the levels need an instrument
+  chSendPatch( ch, patch );
+}
+
+void YM3812::patchNoteOff( YM_Patch patch, uint8_t midiNote ){
   for( uint8_t ch = 0; ch<num_channels; ch++ ){
-    if( channel_states[ch].pPatch == &patch ){
-      if( channel_states[ch].midi_note == midiNote ){
-        channel_states[ ch ].state_changed = millis();                         // Save the time that the state changed
-        channel_states[ ch ].note_state = false;                               // Indicate that the note is currently off
-        regKeyOn( ch, 0 );                                                     // Turn off any channels associated with the midiNote
+    if( channel_states[ch].patch == patch ){
+      if( channel_states[ch].midi_note == midiNote && channel_states[ch].note_state ){
+        chNoteOff( ch );                                                       // Turn off any channels associated with the midiNote (unless it already let go)
       }
     }
   }
 }
 
-void YM3812::patchAllOff( PatchArr &patch ){
+void YM3812::patchAllOff( YM_Patch patch ){
   for( uint8_t ch = 0; ch<num_channels; ch++ ){
-    if( channel_states[ch].pPatch == &patch ){
-      channel_states[ ch ].state_changed = millis();                           // Save the time that the state changed
-      channel_states[ ch ].note_state = false;                                 // Indicate that the note is currently off
-      regKeyOn( ch, 0 );                                                       // Turn off any channels associated with the midiNote
+    if( channel_states[ch].patch == patch && channel_states[ch].note_state ){
+      chNoteOff( ch );                                                         // Turn off any channels associated with the patch that are still on
     }
   }
 }
 
-void YM3812::patchUpdate( PatchArr &patch ){                                   // Update the patch data of any active channels assocaited with the patch
+void YM3812::patchUpdateField( YM_Patch patch, uint8_t field ){                // Update channels playing a patch after a single field changed
   for( byte ch = 0; ch < num_channels; ch++ ){                                 // Loop through each channel
-    if( channel_states[ch].pPatch == &patch ) chSendPatch( ch, patch );        // If the channel uses the patch, update the patch data on the chip
+    if( channel_states[ch].patch == patch ) chUpdateField( ch, field );        // Only the register holding the field gets written
   }
 }
 
-void YM3812::patchPitchBend( PatchArr &patch, uint16_t pitchBend){             // Update the pitch of all notes associated with patch based on pitchBend
+void YM3812::patchUpdate( YM_Patch patch ){                                    // Update the patch data of any active channels assocaited with the patch
   for( byte ch = 0; ch < num_channels; ch++ ){                                 // Loop through each channel
-    if( channel_states[ch].pPatch == &patch ){
-      if( pitchBend == 0x2000 ){                                               // When not in use, do this the easy way
-        channel_states[ ch ].bend_note = 0;                                    // no pitch bend, so bend_note is just zero
-        channel_states[ ch ].bend_rem = 0;                                     // no pitch bend, so bend_rem is just zero
-      } else {                                                                 // When pitchBend is set, calculate the new values
-        channel_states[ ch ].bend_note = (pitchBend / bend_note_size) - bend_note_offset; // Calculate the whole number of semitones to bend
-        channel_states[ ch ].bend_rem = pitchBend % bend_note_size;            // Calculate the remaining portion of a semitone to bend
-      }
+    if( channel_states[ch].patch == patch ) chSendPatch( ch, patch );          // If the channel uses the patch, update the patch data on the chip
+  }
+}
+
+bool YM3812::patchInUse( YM_Patch patch ){                                     // True while any channel can still be heard playing the patch
+  for( byte ch = 0; ch < num_channels; ch++ ){
+    if( channel_states[ch].patch == patch && !chIdle( ch ) ) return( true );   // Still on, or still releasing
+  }
+  return( false );
+}
+
+void YM3812::patchForget( YM_Patch patch ){                                    // Drop the patch from silent channels so its data can be reused
+  for( byte ch = 0; ch < num_channels; ch++ ){                                 // (otherwise the handle would match whatever goes there next)
+    if( channel_states[ch].patch == patch ){
+      channel_states[ch].patch = YM_Patch();                                   // Channel gets a fresh patch with its next note
+      channel_states[ch].preloaded = false;
+    }
+  }
+}
+
+void YM3812::patchPitchBend( YM_Patch patch, uint16_t pitchBend){              // Update the pitch of all notes associated with patch based on pitchBend
+  int16_t bend = bendOffset( pitchBend );                                      // Convert the wheel value once for all of the channels
+  for( byte ch = 0; ch < num_channels; ch++ ){                                 // Loop through each channel
+    if( channel_states[ch].patch == patch ){
+      if( channel_states[ch].bend == bend ) continue;                          // Nothing to do if the channel is already bent this far
+      channel_states[ch].bend = bend;                                          // Store the new offset
       chSetPitch(ch);
     }
   }
 }
 
 
+// patchCompile Theory of Operation:
+// Turns one voice of a patch into the values of the YM3812 registers that play it. Patches from a packed bank are
+// already stored this way, so decoding them is just a copy out of flash. Generic patches keep every value between
+// 0 and 127, so here we scale those values to the correct bit depth and combine them into the register map of the
+// YM3812. Either way, the result is laid out like a packed voice (see PACKED_REG_* in YMDefs.h).
+
+void YM3812::patchCompile( YM_Patch patch, uint8_t voice, uint8_t *image ){
+  if( patch.type == PATCH_TYPE_PACKED ){
+    if( voice == 0 || (pgm_read_byte( patch.data + PACKED_FLAGS ) & PACKED_FLAG_VOICE2) ){ // Make sure the voice is in the bank
+      memcpy_P( image, patch.data + PACKED_VOICE + voice * PACKED_VOICE_SIZE, PACKED_VOICE_SIZE ); // Already a register image
+      return;
+    }
+  }
+
+  image[PACKED_REG_C0] = ((patch[PATCH_FEEDBACK]>>4)<<1) |                     // Compose the feedback and Algorithm values
+                          (patch[PATCH_ALGORITHM]>>6);                         // into a single byte
+
+  for( uint8_t op = 0; op<2; op++ ){
+    uint8_t *reg = image + 1 + op * PACKED_OP_SIZE;                            // Operator's registers in the image
+    uint8_t patch_offset = PATCH_OP_SETTINGS * (voice*2 + op);                 // Determine operator's index offset for the patch properties
+
+    reg[PACKED_REG_20] =      ((patch[patch_offset + PATCH_TREMOLO        ]>>6)<<7) |  // Compose Tremolo, vibrato, percussive envelope
+                              ((patch[patch_offset + PATCH_VIBRATO        ]>>6)<<6) |  // envelope scaling flags along with frequency
+                              ((patch[patch_offset + PATCH_PERCUSSIVE_ENV ]>>6)<<5) |  // multiple into a single 8-bit register value
+                              ((patch[patch_offset + PATCH_ENV_SCALING    ]>>6)<<4) |
+                              ((patch[patch_offset + PATCH_FREQUENCY_MULT ]>>3)<<0);
+    reg[PACKED_REG_40] =      ((patch[patch_offset + PATCH_LEVEL_SCALING  ]>>5)<<6) |  // Compose level scaling and level
+                              ((patch[patch_offset + PATCH_LEVEL          ]>>1)<<0);
+    reg[PACKED_REG_60] =      ((patch[patch_offset + PATCH_ATTACK         ]>>3)<<4) |  // Compose attack and decay
+                              ((patch[patch_offset + PATCH_DECAY          ]>>3)<<0);
+    reg[PACKED_REG_80] = ((0xF-(patch[patch_offset + PATCH_SUSTAIN_LEVEL  ]>>3))<<4) | // Compose sustain level (inverted) and release rate
+                              ((patch[patch_offset + PATCH_RELEASE_RATE   ]>>3)<<0);
+    reg[PACKED_REG_E0] =      ((patch[patch_offset + PATCH_WAVEFORM       ]>>5)<<0);   // Waveform
+  }
+}
+
+
+
+/**************************
+* Packed Patch Functions  *
+**************************/
+
+// unpackPatchField Theory of Operation:
+// Lets a packed patch be read like a generic one (one value at a time, between 0 and 127), which is what anything
+// outside of chSendPatch expects. The flag byte tells us which optional blocks are present, so the position of
+// every value can be worked out directly without walking through the patch. Values the packed format doesn't
+// store (because the YM3812 doesn't use them) read back as zero.
+
+uint8_t unpackPatchField( const uint8_t *packed, uint8_t field ){
+  uint8_t flags = pgm_read_byte( packed + PACKED_FLAGS );
+
+  if( field == PATCH_PROC_CONF   ) return( pgm_read_byte( packed + PACKED_PROC_CONF   ) );
+  if( field == PATCH_NOTE_NUMBER ) return( pgm_read_byte( packed + PACKED_NOTE_NUMBER ) );
+
+  if( field < PATCH_FEEDBACK || field == PATCH_TREMOLO_SENS || field == PATCH_VIBRATO_SENS ){ // Virtual settings
+    if( !(flags & PACKED_FLAG_VIRTUAL) ) return( 0 );
+    uint8_t offset = PACKED_VOICE + PACKED_VOICE_SIZE;                         // Virtual block sits after the voices
+    if( flags & PACKED_FLAG_VOICE2 ) offset += PACKED_VOICE_SIZE + 1;          // (and the second voice's detune)
+    offset += (field < PATCH_FEEDBACK) ? field - PATCH_PEG_INIT_LEVEL : field - PATCH_TREMOLO_SENS + 4;
+    return( pgm_read_byte( packed + offset ) );
+  }
+
+  uint8_t reg_C0 = pgm_read_byte( packed + PACKED_VOICE + PACKED_REG_C0 );
+  if( field == PATCH_FEEDBACK  ) return( GET_BITS( reg_C0, 0b00001110, 1 ) << 4 );
+  if( field == PATCH_ALGORITHM ) return( GET_BITS( reg_C0, 0b00000001, 0 ) << 6 );
+
+  uint8_t op      = (field - PATCH_GEN_SETTINGS) / PATCH_OP_SETTINGS;          // Which operator (0-3)
+  uint8_t setting = (field - PATCH_GEN_SETTINGS) % PATCH_OP_SETTINGS + PATCH_GEN_SETTINGS; // Which operator setting (PATCH_WAVEFORM ...)
+  if( op > 1 && !(flags & PACKED_FLAG_VOICE2) ) return( 0 );                   // Operators 3 & 4 only exist with a second voice
+  if( setting == PATCH_DETUNE_FINE ){
+    return( op == 2 ? pgm_read_byte( packed + PACKED_VOICE + PACKED_VOICE_SIZE*2 ) : 0 );
+  }
+
+  const uint8_t *reg = packed + PACKED_VOICE + (op>>1) * PACKED_VOICE_SIZE + 1 + (op&1) * PACKED_OP_SIZE;
+  uint8_t reg_20 = pgm_read_byte( reg + PACKED_REG_20 );
+  uint8_t reg_40 = pgm_read_byte( reg + PACKED_REG_40 );
+  uint8_t reg_60 = pgm_read_byte( reg + PACKED_REG_60 );
+  uint8_t reg_80 = pgm_read_byte( reg + PACKED_REG_80 );
+
+  switch( setting ){
+    case PATCH_WAVEFORM:       return( (pgm_read_byte( reg + PACKED_REG_E0 ) & 0b111) << 5 );
+    case PATCH_LEVEL:          return( GET_BITS( reg_40, 0b00111111, 0 ) << 1 );
+    case PATCH_LEVEL_SCALING:  return( GET_BITS( reg_40, 0b11000000, 6 ) << 5 );
+    case PATCH_ENV_SCALING:    return( GET_BITS( reg_20, 0b00010000, 4 ) << 6 );
+    case PATCH_PERCUSSIVE_ENV: return( GET_BITS( reg_20, 0b00100000, 5 ) << 6 );
+    case PATCH_ATTACK:         return( GET_BITS( reg_60, 0b11110000, 4 ) << 3 );
+    case PATCH_DECAY:          return( GET_BITS( reg_60, 0b00001111, 0 ) << 3 );
+    case PATCH_SUSTAIN_LEVEL:  return( (0xF - GET_BITS( reg_80, 0b11110000, 4 )) << 3 );
+    case PATCH_RELEASE_RATE:   return( GET_BITS( reg_80, 0b00001111, 0 ) << 3 );
+    case PATCH_TREMOLO:        return( GET_BITS( reg_20, 0b10000000, 7 ) << 6 );
+    case PATCH_VIBRATO:        return( GET_BITS( reg_20, 0b01000000, 6 ) << 6 );
+    case PATCH_FREQUENCY_MULT: return( GET_BITS( reg_20, 0b00001111, 0 ) << 3 );
+  }
+  return( 0 );                                                                 // Not used by the YM3812
+}
+
+
+
+/************************
+* Instrument Functions  *
+************************/
+
+void YM3812::instNoteOff( uint8_t inst, uint8_t midiNote ){                   // Turn off a note played on an instrument, whichever patch it used
+  if( inst < YM_MAX_INSTRUMENTS && inst_states[inst].mono && monoNoteOff( inst, midiNote ) ) return; // Mono voice took care of it
+  for( uint8_t ch = 0; ch<num_channels; ch++ ){
+    if( channel_states[ch].inst == inst && channel_states[ch].midi_note == midiNote && channel_states[ch].note_state ){
+      chNoteOff( ch );                                                         // Turn off the channel (unless it already let go)
+    }
+  }
+}
+
+void YM3812::instAllOff( uint8_t inst ){                                       // Turn off everything the instrument is playing
+  for( uint8_t ch = 0; ch < num_channels; ch++ ){
+    if( channel_states[ch].inst == inst && channel_states[ch].note_state ) chNoteOff( ch );
+  }
+  if( inst >= YM_MAX_INSTRUMENTS ) return;
+  inst_states[inst].num_held = 0;                                              // Nothing is held anymore, so a mono voice can't come back
+  inst_states[inst].mono_ch = 0xFF;
+}
+
+void YM3812::instPitchBend( uint8_t inst, uint16_t pitchBend ){                // Update the pitch of all notes on an instrument based on pitchBend
+  int16_t bend = bendOffset( pitchBend );                                      // Convert the wheel value once for all of the channels
+  for( byte ch = 0; ch < num_channels; ch++ ){                                 // Loop through each channel
+    if( channel_states[ch].inst == inst ){
+      if( channel_states[ch].bend == bend ) continue;                          // Nothing to do if the channel is already bent this far
+      channel_states[ch].bend = bend;                                          // Store the new offset
+      chSetPitch(ch);
+    }
+  }
+}
+
+void YM3812::instSetVelocityCurve( uint8_t inst, uint8_t curve ){              // Select the velocity curve for an instrument
+  if( inst >= YM_MAX_INSTRUMENTS || curve >= VEL_CURVES ) return;              // Ignore anything out of range
+  inst_states[inst].vel_curve = curve;                                         // Takes effect on the next note played
+}
+
+void YM3812::instSetVolume( uint8_t inst, uint8_t val ){                       // Set the volume (CC7) of an instrument
+  if( inst >= YM_MAX_INSTRUMENTS ) return;
+  inst_states[inst].volume = val & 0x7F;
+  instSetLevels( inst );                                                       // Apply it to the notes already playing
+}
+
+void YM3812::instSetExpression( uint8_t inst, uint8_t val ){                   // Set the expression (CC11) of an instrument
+  if( inst >= YM_MAX_INSTRUMENTS ) return;
+  inst_states[inst].expression = val & 0x7F;
+  instSetLevels( inst );                                                       // Apply it to the notes already playing
+}
+
+void YM3812::instSetLevels( uint8_t inst ){                                    // Work out an instrument's attenuation and update its channels
+  YM_Instrument &state = inst_states[inst];
+  uint8_t atten = pgm_read_byte( &VOLUME_TABLE[ state.volume ] ) + pgm_read_byte( &VOLUME_TABLE[ state.expression ] );
+  if( atten == state.atten ) return;                                           // Controller moved, but not far enough to change the level
+  state.atten = atten;
+  for( uint8_t ch = 0; ch < num_channels; ch++ ){                              // Loop through each channel
+    if( channel_states[ch].inst == inst ) chSetLevels( ch );                   // Only the carriers that changed get written
+  }
+}
+
+void YM3812::instSwapPatch( uint8_t inst, YM_Patch from, YM_Patch to ){       // Move an instrument's notes over to another copy of their patch
+  for( uint8_t ch = 0; ch < num_channels; ch++ ){                              // (used when a patch gets copied into RAM to be edited)
+    if( channel_states[ch].inst == inst && channel_states[ch].patch == from ) channel_states[ch].patch = to;
+  }
+}
+
+void YM3812::instSetMaxVoices( uint8_t inst, uint8_t voices ){               // Limit how many channels an instrument can play at once
+  if( inst >= YM_MAX_INSTRUMENTS ) return;
+  inst_states[inst].max_voices = ( voices == 0 || voices >= num_channels ) ? 0xFF : voices; // Takes effect on the next note played
+}
+
+void YM3812::instSetReservedVoices( uint8_t inst, uint8_t voices ){            // Keep channels free for an instrument
+  if( inst >= YM_MAX_INSTRUMENTS ) return;
+  YM_Instrument &state = inst_states[inst];
+  if( voices > num_channels ) voices = num_channels;
+  if( state.voices < state.reserved ) reserved_free -= state.reserved - state.voices; // Take out the old reservation
+  state.reserved = voices;
+  if( state.voices < state.reserved ) reserved_free += state.reserved - state.voices; // and put in the new one
+}
+
+void YM3812::instSetMono( uint8_t inst, bool on ){                             // Turn mono mode on or off for an instrument
+  if( inst >= YM_MAX_INSTRUMENTS ) return;
+  instAllOff( inst );                                                          // Changing mode turns off the instrument's notes (like MIDI's mode messages)
+  inst_states[inst].mono = on;                                                 // and starts with an empty held note stack
+}
+
+void YM3812::instSetMonoPriority( uint8_t inst, uint8_t priority ){            // Select which held note a mono instrument plays
+  if( inst >= YM_MAX_INSTRUMENTS || priority >= MONO_PRIORITIES ) return;      // Ignore anything out of range
+  inst_states[inst].mono_priority = priority;                                  // Takes effect on the next note on or off
+}
+
+void YM3812::instSetGlide( uint8_t inst, bool on ){                            // Turn portamento on or off for an instrument
+  if( inst < YM_MAX_INSTRUMENTS ) inst_states[inst].glide_on = on;             // Takes effect on the next note played
+}
+
+void YM3812::instSetGlideTime( uint8_t inst, uint8_t val ){                    // Set how long a glide between two notes takes
+  if( inst < YM_MAX_INSTRUMENTS ) inst_states[inst].glide_time = val & 0x7F;
+}
+
+void YM3812::instSetModWheel( uint8_t inst, uint8_t val ){                     // Mod wheel scales the depth of the LFO
+  if( inst < YM_MAX_INSTRUMENTS ) inst_states[inst].mod_wheel = val & 0x7F;    // Picked up by lfoUpdate on the next tick
+}
+
+void YM3812::instSetLfoRate( uint8_t inst, uint8_t val ){                      // Set the speed of an instrument's LFO
+  if( inst >= YM_MAX_INSTRUMENTS ) return;
+  inst_states[inst].lfo_rate = val & 0x7F;
+  inst_states[inst].lfo_inc  = lfoIncrement( val & 0x7F, control_rate );       // Convert to a phase change per tick
+}
+
+void YM3812::instSetLfoDepth( uint8_t inst, uint8_t val ){                     // Set the depth of the LFO with the mod wheel all the way up
+  if( inst < YM_MAX_INSTRUMENTS ) inst_states[inst].lfo_depth = val & 0x7F;
+}
+
+void YM3812::instSetLfoDelay( uint8_t inst, uint8_t val ){                     // Set how long the LFO takes to fade in (from the next note on)
+  if( inst < YM_MAX_INSTRUMENTS ) inst_states[inst].lfo_delay = val & 0x7F;
+}
+
+void YM3812::instSetLfoWave( uint8_t inst, uint8_t wave ){                     // Select the LFO waveform
+  if( inst < YM_MAX_INSTRUMENTS && wave < LFO_WAVES ) inst_states[inst].lfo_wave = wave;
+}
+
+
+
+/************************
+* Pitch Envelope        *
+************************/
+
+// Pitch Envelope Theory of Operation:
+// The pitch envelope adds an offset (in the same 8.8 fixed point semitones as pitch bend) to the pitch of a note.
+// At note on the offset starts at PATCH_PEG_INIT_LEVEL and moves back to zero over PATCH_PEG_ATTACK. At note off it
+// moves to PATCH_PEG_REL_LEVEL over PATCH_PEG_RELEASE. pegMoveTo works out a fixed step per control tick, and
+// pegUpdate applies those steps through chSetPitch, which only writes the frequency registers when the F-Number
+// actually moves. The control tick may not get around to every channel on every tick when it is busy, so each
+// channel remembers the tick it was last updated on and catches up on the steps it missed on its next turn.
+
+void YM3812::pegMoveTo( uint8_t ch, int16_t target, uint8_t time ){
+  YM_Channel &state = channel_states[ch];
+  state.peg_target = target;
+  state.peg_tick = control_ticks;                                                  // Steps are counted from this tick
+  state.peg_step = 0;
+
+  if( time == 0 || state.peg == target ){                                      // No time to get there (or already there),
+    state.peg = target;                                                        // so jump straight to the target
+    return;
+  }
+
+  uint32_t ticks = (uint32_t(time) * time * control_rate) / 4000;              // Time is (time^2 / 4) milliseconds, converted into control ticks
+  if( ticks == 0 ) ticks = 1;
+  state.peg_step = (int32_t(target) - state.peg) / int32_t(ticks);             // Distance to cover each tick
+  if( state.peg_step == 0 ) state.peg_step = (target > state.peg) ? 1 : -1;    // Always make some progress
+}
+
+void YM3812::pegUpdate( uint8_t ch ){                                          // Step a channel's pitch envelope forward
+  YM_Channel &state = channel_states[ch];
+  if( state.peg_step == 0 ) return;                                            // Envelope isn't moving
+
+  int32_t peg = state.peg + int32_t(state.peg_step) * uint8_t(control_ticks - state.peg_tick); // Catch up on every tick since the last update
+  state.peg_tick = control_ticks;
+  if( (state.peg_step > 0) ? (peg >= state.peg_target) : (peg <= state.peg_target) ){
+    peg = state.peg_target;                                                    // Made it to the target
+    state.peg_step = 0;                                                        // so the envelope can rest
+  }
+  state.peg = peg;
+  chSetPitch( ch );                                                            // Send the new pitch (if the F-Number moved)
+}
+
+
+
+/************************
+* Mono Mode             *
+************************/
+
+// Mono Mode Theory of Operation:
+// A mono instrument keeps a small stack of the notes being held, oldest first. Every note on and off updates the
+// stack, and monoNote picks the note that should be heard from it based on the priority (newest, lowest or
+// highest). If the mono voice is still sounding, it is simply moved to that note with chGlideTo, which only
+// touches the frequency registers (and glides there if portamento is on). A new note is only started (patch sent
+// and keyed on) when nothing is sounding, and it goes back onto the channel the mono voice used last, so a mono
+// instrument only ever takes up one channel (two for a 2x2OP patch). When the last held note is released, the
+// voice is keyed off. If the stack overflows, the oldest note is forgotten.
+
+bool YM3812::monoNoteOn( uint8_t inst, YM_Patch patch, uint8_t midiNote ){
+  YM_Instrument &state = inst_states[inst];
+  uint8_t ch = monoChannel( inst );
+
+  if( ch == 0xFF || channel_states[ch].patch != patch ) state.num_held = 0;   // Nothing sounding, so nothing is held either
+  for( uint8_t i = 0; i < state.num_held; i++ ){                               // Take the note out of the stack if it's already there
+    if( state.held[i] == midiNote ){
+      memmove( state.held + i, state.held + i + 1, --state.num_held - i );
+      break;
+    }
+  }
+  if( state.num_held == MONO_STACK_SIZE ){                                     // Stack is full, so forget the oldest note
+    memmove( state.held, state.held + 1, --state.num_held );
+  }
+  state.held[ state.num_held++ ] = midiNote;                                   // Newest note goes on top
+
+  if( state.num_held == 1 ) return( false );                                   // First note, so it needs to be started
+  uint8_t note = monoNote( inst );
+  if( note != channel_states[ch].midi_note ) chGlideTo( ch, note );            // Legato, move the playing voice to the note
+  return( true );
+}
+
+bool YM3812::monoNoteOff( uint8_t inst, uint8_t midiNote ){
+  YM_Instrument &state = inst_states[inst];
+  uint8_t i;
+
+  for( i = 0; i < state.num_held; i++ ) if( state.held[i] == midiNote ) break;
+  if( i == state.num_held ) return( false );                                   // Not one of ours (maybe from before mono was on)
+  memmove( state.held + i, state.held + i + 1, --state.num_held - i );         // Take it out of the stack
+
+  uint8_t ch = monoChannel( inst );
+  if( ch == 0xFF ) return( true );                                             // Voice was stolen, nothing left to do
+
+  if( state.num_held == 0 ){                                                   // Last note released
+    chNoteOff( ch );
+    if( channel_states[ch].link != 0xFF ) chNoteOff( channel_states[ch].link ); // Along with the other half of a pair
+  } else {
+    uint8_t note = monoNote( inst );                                           // Go back to one of the notes still held
+    if( note != channel_states[ch].midi_note ) chGlideTo( ch, note );
+  }
+  return( true );
+}
+
+uint8_t YM3812::monoNote( uint8_t inst ){                                      // Pick the held note to play based on priority
+  YM_Instrument &state = inst_states[inst];
+  uint8_t note = state.held[ state.num_held - 1 ];                             // Newest note (MONO_LAST)
+
+  if( state.mono_priority != MONO_LAST ){
+    for( uint8_t i = 0; i < state.num_held; i++ ){
+      if( state.mono_priority == MONO_LOW  ? state.held[i] < note : state.held[i] > note ) note = state.held[i];
+    }
+  }
+  return( note );
+}
+
+uint8_t YM3812::monoChannel( uint8_t inst ){                                   // Find the channel still sounding the mono voice
+  uint8_t ch = inst_states[inst].mono_ch;
+  if( ch >= num_channels ) return( 0xFF );
+  if( channel_states[ch].inst != inst || !channel_states[ch].note_state ) return( 0xFF ); // Stolen or already released
+  if( channel_states[ch].voice ) return( 0xFF );                               // Stolen and reused as the second half of a pair
+  return( ch );
+}
+
+
+
+/************************
+* Portamento            *
+************************/
+
+// Portamento Theory of Operation:
+// When glide is on for an instrument, a note on that arrives while one of its notes is still held doesn't get a
+// new channel. chGlideTo moves the held channel's midi_note to the new note and sets glide to the distance back
+// to where it was, so the pitch doesn't jump. glideUpdate then walks glide to zero at control rate, and chSetPitch
+// adds it into the fixed point pitch just like the pitch envelope. The note is never keyed off and the patch isn't
+// sent again, so a glide only ever writes the frequency registers (A0/B0), and only when the F-Number moves.
+// Glide time uses the same (time^2 / 4) millisecond curve as the pitch envelope, and is the same for any interval.
+// Mono mode uses chGlideTo for its legato note changes too, which jump straight to the note when glide is off.
+
+void YM3812::chGlideTo( uint8_t ch, uint8_t midiNote ){                        // Slide a playing note over to a new midi note
+  uint8_t link = channel_states[ch].link;
+  YM_Instrument &inst = inst_states[ channel_states[ch].inst ];
+  uint32_t ticks = inst.glide_on ? (uint32_t(inst.glide_time) * inst.glide_time * control_rate) / 4000 : 0; // Without portamento, jump straight there
+
+  for( uint8_t v = 0; v < 2; v++ ){                                            // Both channels of a pair move together
+    uint8_t c = v ? link : ch;
+    if( c >= num_channels ) break;
+    YM_Channel &state = channel_states[c];
+
+    int32_t glide = state.glide + (int16_t(state.midi_note) - midiNote) * 256;  // Keep the pitch where it is for now
+    state.glide = constrain( glide, -0x7F00, 0x7F00 );
+    state.midi_note = midiNote;
+    state.state_changed = millis();                                            // Counts as the newest note on the instrument
+    state.glide_tick = control_ticks;
+    state.glide_step = 0;
+
+    if( ticks == 0 || state.glide == 0 ) state.glide = 0;                      // No glide time, so jump straight to the note
+    else {
+      state.glide_step = -int32_t(state.glide) / int32_t(ticks);               // Distance to cover each tick
+      if( state.glide_step == 0 ) state.glide_step = (state.glide < 0) ? 1 : -1; // Always make some progress
+    }
+    chSetPitch( c );
+  }
+}
+
+void YM3812::glideUpdate( uint8_t ch ){                                        // Step a channel's portamento forward
+  YM_Channel &state = channel_states[ch];
+  if( state.glide_step == 0 ) return;                                          // Not gliding
+
+  int32_t glide = state.glide + int32_t(state.glide_step) * uint8_t(control_ticks - state.glide_tick); // Catch up on every tick since the last update
+  state.glide_tick = control_ticks;
+  if( (state.glide_step > 0) ? (glide >= 0) : (glide <= 0) ){
+    glide = 0;                                                                 // Made it to the new note
+    state.glide_step = 0;
+  }
+  state.glide = glide;
+  chSetPitch( ch );                                                            // Send the new pitch (if the F-Number moved)
+}
+
+
+
+/************************
+* LFO                   *
+************************/
+
+// LFO Theory of Operation:
+// The YM3812 only has one global vibrato and tremolo setting, so every midi channel gets its own LFO in software.
+// The phase of each LFO moves on every control tick (controlTick), and lfoUpdate reads the waveform table at that
+// phase for each channel. The depth is the instrument's LFO depth scaled by the mod wheel, faded in after note on,
+// and split between vibrato and tremolo by the patch's PATCH_VIBRATO_SENS and PATCH_TREMOLO_SENS. Vibrato becomes a
+// pitch offset (up to about a semitone) and tremolo becomes extra attenuation on the carriers (up to 15 steps).
+// Both are compared with what was last sent, so the registers only get written when something actually changes.
+// That keeps the cost of a channel to a table read, a few multiplies and at most four register writes.
+
+void YM3812::lfoSetSens( uint8_t ch ){                                         // Get a channel's vibrato and tremolo sensitivities
+  YM_Channel &state = channel_states[ch];
+  state.lfo_vsens = state.patch[PATCH_VIBRATO_SENS];                           // Look up the patch's sensitivities once
+  state.lfo_tsens = state.patch[PATCH_TREMOLO_SENS];                           // rather than on every tick
+  if( !state.lfo_vsens && !state.lfo_tsens ) state.lfo_vsens = 64;             // Patches without either get a gentle vibrato, so the mod wheel always does something
+}
+
+void YM3812::lfoStart( uint8_t ch ){                                           // Get a channel's LFO ready for a new note
+  YM_Channel &state = channel_states[ch];
+  uint8_t delay = inst_states[ state.inst ].lfo_delay;
+
+  lfoSetSens( ch );
+  uint32_t ticks = (uint32_t(delay) * delay * control_rate) / 4000;            // Delay is (delay^2 / 4) milliseconds, converted into control ticks
+  state.lfo_step = ticks ? ( ticks < 0xFFFF ? 0xFFFF / ticks : 1 ) : 0xFFFF;   // Fade in a little each tick
+  state.lfo_fade = ticks ? 0 : 0xFFFF;                                         // No delay means full depth straight away
+  state.lfo_vib  = 0;                                                          // Nothing applied yet
+  state.lfo_trem = 0;
+}
+
+void YM3812::lfoUpdate( uint8_t ch ){                                          // Apply the LFO to a channel
+  YM_Channel &state = channel_states[ch];
+  if( state.inst >= YM_MAX_INSTRUMENTS ) return;                               // Channel hasn't been used yet
+  YM_Instrument &inst = inst_states[ state.inst ];
+
+  uint16_t depth = (uint16_t(inst.lfo_depth) * inst.mod_wheel) >> 7;           // Depth scaled by the mod wheel (0 - 126)
+  if( !depth && !state.lfo_vib && !state.lfo_trem ) return;                    // Nothing to do, and nothing to undo
+
+  if( state.lfo_fade < 0xFFFF - state.lfo_step ) state.lfo_fade += state.lfo_step; // Fade the LFO in after note on
+  else state.lfo_fade = 0xFFFF;
+  depth = (depth * (state.lfo_fade >> 8)) >> 8;
+
+  int8_t wave = pgm_read_byte( &LFO_WAVE[ inst.lfo_wave ][ inst.lfo_phase >> 10 ] ); // Where the waveform is at (-127 to 127)
+
+  int16_t vib = (int16_t(wave) * int16_t((depth * state.lfo_vsens) >> 7)) >> 6;  // Vibrato offset (8.8 fixed point semitones)
+  if( vib != state.lfo_vib ){
+    state.lfo_vib = vib;
+    chSetPitch( ch );                                                          // Only sends the frequency bytes that moved
+  }
+
+  uint8_t trem = (uint16_t(wave + 128) * ((depth * state.lfo_tsens) >> 7)) >> 11; // Tremolo attenuation (0 - 15 steps)
+  if( trem != state.lfo_trem ){
+    state.lfo_trem = trem;
+    chSetLevels( ch );                                                         // Only sends the levels that changed
+  }
+}
+
+
+
 /************************
 * Channel Functions     *
 ************************/
 
 // chSendPatch Theory of Operation:
 // This function is the heart of the class, and without too many modifications can be updated to work with any of the
-// Yamaha synthesis chips. The function accepts a generalized patch array with values in order according to the
-// indicies outlined in YMDefs.h. Because all values in the array are between 0 and 127, this function scales
-// those values to the correct bit depth, combines them with other values to produce the correct combinations for the register
-// map of the YM3812 and then sends them to the sound chip.
+// Yamaha synthesis chips. The patch is first compiled into a register image with patchCompile (see below), then the
+// levels of the carrier operators are scaled by the note's velocity before the whole image is sent to the chip.
+
+void YM3812::chSendPatch( byte ch, YM_Patch patch ){
+  PROFILE_ZONE( PROF_SEND_PATCH );
+  stats.patch_loads++;
+  if( patch != channel_states[ch].patch ) channel_states[ch].preloaded = false; // Registers no longer hold the preloaded patch
+  uint8_t  image[ PACKED_VOICE_SIZE ];                                         // Register values for the voice
+  uint8_t  mem_offset;
 
-void YM3812::chSendPatch( byte ch, PatchArr &patch ){
-  uint8_t  mem_offset, patch_offset;
-  uint8_t  op_level;
+  patchCompile( patch, channel_states[ch].voice, image );                      // Work out the register values for the channel's voice
 
   //Channel Settings
-  sendData( 0xC0+ch,  ((patch[PATCH_FEEDBACK]>>4)<<1) |                        // Compose the feedback and Algorithm values
-                       (patch[PATCH_ALGORITHM]>>6)    );                       // into a single byte and send to YM3812
+  sendData( 0xC0+ch, image[PACKED_REG_C0] );                                   // Send feedback and algorithm to YM3812
+  channel_states[ch].carriers = 0;                                             // Worked out again below
 
   for( uint8_t op = 0; op<2; op++ ){
-    mem_offset = op_map[channel_map[ch] + op*3];                               // Determine memory offset for slot 1 for the channel
-    patch_offset = PATCH_OP_SETTINGS * op;                                     // Determine operator's index offset for the patch properties 
+    mem_offset = opOffset( ch, op );                                           // Determine memory offset of the operator for the channel
+    uint8_t *reg = image + 1 + op * PACKED_OP_SIZE;                            // Find the operator's registers in the image
 
-    if( (patch[PATCH_ALGORITHM] == 0) && (op==0) ){
-      op_level = patch[patch_offset + PATCH_LEVEL] >> 1;
-    } else {
-      op_level = 63-( ( (127 - patch[patch_offset + PATCH_LEVEL]) * channel_states[ ch ].velocity ) >> 8);
+    reg_40[ch][op] = chOpLevel( ch, op, reg[PACKED_REG_40], (image[PACKED_REG_C0] & 1) || (op==1) ); // Carriers (the ones we can hear) get scaled by velocity
+
+    sendData( 0x20+mem_offset, reg[PACKED_REG_20] );                           // Tremolo, vibrato, percussive env, env scaling, multiplier
+    sendData( 0x40+mem_offset, reg_40[ch][op] );                               // Level scaling and the velocity scaled level
+    sendData( 0x60+mem_offset, reg[PACKED_REG_60] );                           // Attack and decay
+    sendData( 0x80+mem_offset, reg[PACKED_REG_80] );                           // Sustain level and release rate
+    sendData( 0xE0+mem_offset, reg[PACKED_REG_E0] );                           // Waveform
+  }
+
+}
+
+void YM3812::chSendLevels( uint8_t ch ){                                       // Velocity scaled levels of a patch that is already on the chip
+  uint8_t image[ PACKED_VOICE_SIZE ];
+  patchCompile( channel_states[ch].patch, channel_states[ch].voice, image );
+
+  for( uint8_t op = 0; op<2; op++ ){
+    uint8_t val = chOpLevel( ch, op, image[1 + op * PACKED_OP_SIZE + PACKED_REG_40], (image[PACKED_REG_C0] & 1) || (op==1) );
+    if( val == reg_40[ch][op] ){ stats.skipped_writes++; continue; }           // Already there
+    sendData( opReg( 0x40, ch, op ), reg_40[ch][op] = val );
+  }
+}
+
+uint8_t YM3812::chOpLevel( uint8_t ch, uint8_t op, uint8_t reg40, bool carrier ){ // Work out the level register of an operator from the patch's value
+  YM_Channel &state = channel_states[ch];
+  uint8_t op_level = reg40 & 0b00111111;                                       // Level as stored in the patch
+
+  state.carriers &= ~(1 << op);
+  if( carrier ){                                                               // Carriers (the ones we can hear) get scaled by velocity
+    uint8_t velocity = pgm_read_byte( &VEL_CURVE_TABLE[ inst_states[ state.inst ].vel_curve ][ state.velocity ] ); // Shape velocity with the instrument's curve
+    uint8_t level = state.patch[ PATCH_OP_SETTINGS * (state.voice*2 + op) + PATCH_LEVEL ]; // Scale the patch's 7-bit level, the register only keeps 6 of them
+    op_level = 63-( ( (127 - level) * velocity ) >> 8);
+    state.level[op] = op_level;                                                // Remember it so modulation can be added later (chSetLevels)
+    state.carriers |= 1 << op;
+    op_level = min( 63, op_level + chAttenuation( ch ) );
+  }
+  return( (reg40 & 0b11000000) | op_level );                                   // Level scaling and the level
+}
+
+// chUpdateField Theory of Operation:
+// Editing a patch one knob at a time only ever changes one field, and every field lives in exactly one register
+// of the channel (or none, for the virtual settings). The whole voice is compiled again, since that is only a few
+// shifts, but only the register that holds the field gets sent. Levels go through chOpLevel so velocity, volume
+// and tremolo are kept, and are compared with the register cache first. Changing the algorithm changes which
+// operators are carriers, so that one sends the whole patch. Settings that only matter at note on (like the
+// pitch envelope) are simply picked up by the next note.
+
+void YM3812::chUpdateField( uint8_t ch, uint8_t field ){
+  YM_Channel &state = channel_states[ch];
+  uint8_t image[ PACKED_VOICE_SIZE ];
+  uint8_t op, reg;
+
+  state.preloaded = false;                                                     // Patch changed since it was preloaded, send it all with the note
+  if( field >= PATCH_SIZE ) return;
+  if( field < PATCH_GEN_SETTINGS ){                                            // Channel settings
+    switch( field ){
+      case PATCH_FEEDBACK:
+        patchCompile( state.patch, state.voice, image );
+        sendData( 0xC0+ch, image[PACKED_REG_C0] );                             // Feedback and algorithm
+        break;
+      case PATCH_ALGORITHM:
+        chSendPatch( ch, state.patch );                                        // Carriers change too, so send everything
+        break;
+      case PATCH_TREMOLO_SENS:
+      case PATCH_VIBRATO_SENS:
+        lfoSetSens( ch );                                                      // Used by the LFO on the next tick
+        break;
+    }
+    return;
+  }
+
+  op = (field - PATCH_GEN_SETTINGS) / PATCH_OP_SETTINGS;                       // Operator in the patch (0-3)
+  field -= PATCH_OP_SETTINGS * op;                                             // Setting within the operator (PATCH_WAVEFORM ... )
+  if( (op >> 1) != state.voice ) return;                                       // Operator belongs to the other channel of a pair
+  if( field == PATCH_DETUNE_FINE ){
+    if( op == 2 ){                                                             // Fine tune of the second voice
+      state.detune = int8_t( state.patch[PATCH_OP_SETTINGS*2 + PATCH_DETUNE_FINE] ) - 64;
+      chSetPitch( ch );
     }
+    return;
+  }
+
+  op &= 1;                                                                     // Operator on the channel
+  patchCompile( state.patch, state.voice, image );
+  uint8_t *regs = image + 1 + op * PACKED_OP_SIZE;                             // Operator's registers in the image
+
+  switch( field ){
+    case PATCH_TREMOLO:
+    case PATCH_VIBRATO:
+    case PATCH_PERCUSSIVE_ENV:
+    case PATCH_ENV_SCALING:
+    case PATCH_FREQUENCY_MULT:  reg = PACKED_REG_20; break;
+    case PATCH_LEVEL:
+    case PATCH_LEVEL_SCALING:   reg = PACKED_REG_40; break;
+    case PATCH_ATTACK:
+    case PATCH_DECAY:           reg = PACKED_REG_60; break;
+    case PATCH_SUSTAIN_LEVEL:
+    case PATCH_RELEASE_RATE:    reg = PACKED_REG_80; break;
+    case PATCH_WAVEFORM:        reg = PACKED_REG_E0; break;
+    default:                    return;                                        // Not used by the YM3812
+  }
 
-    sendData( 0x20+mem_offset,      ((patch[patch_offset + PATCH_TREMOLO        ]>>6)<<7) |  // Compose Tremolo, vibrato, percussive envelope
-                                    ((patch[patch_offset + PATCH_VIBRATO        ]>>6)<<6) |  // envelope scaling flags along with frequency
-                                    ((patch[patch_offset + PATCH_PERCUSSIVE_ENV ]>>6)<<5) |  // multiple into a single 8-bit register value
-                                    ((patch[patch_offset + PATCH_ENV_SCALING    ]>>6)<<4) |  // and send to the YM3812
-                                    ((patch[patch_offset + PATCH_FREQUENCY_MULT ]>>3)<<0) );
+  if( reg == PACKED_REG_40 ){
+    uint8_t val = chOpLevel( ch, op, regs[PACKED_REG_40], state.carriers & (1 << op) );
+    if( val == reg_40[ch][op] ){ stats.skipped_writes++; return; }             // Edit didn't change the level on this channel
+    sendData( opReg( 0x40, ch, op ), reg_40[ch][op] = val );
+    return;
+  }
+  static const uint8_t REG_ADDR[] = { 0x20, 0x40, 0x60, 0x80, 0xE0 };          // Register address for each PACKED_REG_* (after 0xC0)
+  sendData( opReg( REG_ADDR[reg - PACKED_REG_20], ch, op ), regs[reg] );
+}
 
-    sendData( 0x40+mem_offset,      ((patch[patch_offset + PATCH_LEVEL_SCALING ]>>5)<<6)  |  // Compose level scaling and level value for the
-                                      op_level                                            ); // output channel and send to the YM3812
-    sendData( 0x60+mem_offset,      ((patch[patch_offset + PATCH_ATTACK        ]>>3)<<4)  |  // Compose attack and decay settings into a single
-                                    ((patch[patch_offset + PATCH_DECAY         ]>>3)<<0)  ); // 8-bit register and send to YM3812
-    sendData( 0x80+mem_offset, ((0xF-(patch[patch_offset + PATCH_SUSTAIN_LEVEL ]>>3))<<4) |  // Compose sustain level (inverted) and release rate settings into a single
-                                    ((patch[patch_offset + PATCH_RELEASE_RATE  ]>>3)<<0) );  // 8-bit register and send to YM3812
-    sendData( 0xE0+mem_offset,      ((patch[patch_offset + PATCH_WAVEFORM      ]>>5)<<0) );  // Send waveform register to YM3812
+// chSetLevels Theory of Operation:
+// Velocity is baked into the carrier levels when the patch is sent. Anything that changes the loudness of a note
+// while it plays (volume, expression and tremolo) is added on top of that as attenuation by chAttenuation. chSetLevels works out the
+// new carrier levels and only sends the ones that are different from the register cache. Modulators are left
+// alone in FM mode, since changing them would change the tone rather than the volume.
+
+void YM3812::chSetLevels( uint8_t ch ){
+  uint8_t atten = chAttenuation( ch );
+  for( uint8_t op = 0; op < 2; op++ ){
+    if( !(channel_states[ch].carriers & (1 << op)) ) continue;                 // Modulator in FM mode, leave it alone
+    uint8_t val = (reg_40[ch][op] & 0b11000000) | min( 63, channel_states[ch].level[op] + atten );
+    if( val == reg_40[ch][op] ){ stats.skipped_writes++; continue; }           // Already there
+    sendData( opReg( 0x40, ch, op ), reg_40[ch][op] = val );
   }
+}
 
+uint8_t YM3812::chAttenuation( uint8_t ch ){                                   // Extra attenuation on top of the velocity scaled carrier levels
+  uint8_t inst = channel_states[ch].inst;
+  uint8_t atten = channel_states[ch].lfo_trem;                                 // Tremolo
+  if( inst < YM_MAX_INSTRUMENTS ) atten += inst_states[inst].atten;            // Plus volume and expression
+  return( atten );
 }
 
-uint8_t YM3812::chGetNext(){
+// chGetNext Theory of Operation:
+// Every instrument counts the channels playing its notes (voices). An instrument can have a limit on voices, and
+// can reserve a number of channels that other instruments can't take from it. reserved_free keeps a running
+// total of the reserved channels that aren't in use, so deciding what the instrument is allowed to take is just
+// a few comparisons of counters:
+//   - At its limit, an instrument can only replace one of its own notes (the one that has been on the longest).
+//     The second voice of a 2x2OP note counts the first one (skip) too, so the pair can't end up over the limit.
+//   - Otherwise it can use a channel that is off, as long as that doesn't eat into another instrument's reserve.
+//   - If it has to steal, it takes the oldest note from an instrument that is over its reservation. Only when
+//     there is nothing like that left does it borrow another instrument's free reserved channel, and after that
+//     the oldest note of all.
+// Each stolen note is counted against the instrument it belonged to (steals), so a part that keeps losing notes
+// shows up in the statistics.
+
+uint8_t YM3812::chGetNext( uint8_t skip, uint8_t inst, YM_Patch patch ){
+  PROFILE_ZONE( PROF_GET_NEXT );
   uint8_t on_channel = 0xFF;                                                   // The channel that has been on the longest 
   uint8_t off_channel = 0xFF;                                                  // The channel that has been OFF the longest
+  uint8_t over_channel = 0xFF;                                                 // The longest running channel of an instrument over its reservation
   unsigned long oldest_on_time = millis(); 
   unsigned long oldest_off_time = millis(); 
+  unsigned long oldest_over_time = millis();
+
+  bool own_only = false;                                                       // Only allowed to replace the instrument's own notes
+  bool use_off  = true;                                                        // Allowed to use a channel that is off
+  if( inst < YM_MAX_INSTRUMENTS ){
+    YM_Instrument &state = inst_states[inst];
+    uint8_t free = num_channels - voices_on;                                   // Channels that are off
+    if( skip < num_channels && !channel_states[skip].note_state ) free--;      // (not counting the one we already took)
+    uint8_t others = reserved_free;                                            // Reserved channels belonging to other instruments
+    if( state.voices < state.reserved ) others -= state.reserved - state.voices;
+    uint8_t voices = state.voices;                                             // Voices the instrument will have once this note plays
+    if( skip < num_channels && !(channel_states[skip].note_state && channel_states[skip].inst == inst) ){
+      voices++;                                                                // (the first half of a 2x2OP note is about to count)
+    }
+    own_only = voices >= state.max_voices;
+    use_off  = !own_only && free > others;
+  }
 
   for( uint8_t ch=0; ch < num_channels; ch++ ){                                // Loop through all of the channels
-    if( channel_states[ch].note_state ){                                       // If the note is turned on...
-      if( channel_states[ch].state_changed < oldest_on_time ){                 // Is this the longest running note?
-        oldest_on_time = channel_states[ch].state_changed;                     // save the current time
+    if( ch == skip ) continue;                                                 // Except for the one we were asked to leave alone
+    YM_Channel &state = channel_states[ch];
+    if( state.note_state ){                                                    // If the note is turned on...
+      if( own_only && state.inst != inst ) continue;                           // At the limit, so only our own notes can go
+      if( state.state_changed < oldest_on_time ){                              // Is this the longest running note?
+        oldest_on_time = state.state_changed;                                  // save the current time
         on_channel = ch;                                                       // save this as our longest running channel
       } 
+      if( state.inst >= YM_MAX_INSTRUMENTS || inst_states[state.inst].voices > inst_states[state.inst].reserved ){
+        if( state.state_changed < oldest_over_time ){                          // Longest running note that isn't reserved
+          oldest_over_time = state.state_changed;
+          over_channel = ch;
+        }
+      }
     } else {                                                                   // If the note is turned off...
-      if( channel_states[ch].state_changed < oldest_off_time ){                // Is this the longest turned off note?
-        oldest_off_time = channel_states[ch].state_changed;                    // save the current time
+      unsigned long off_time = state.state_changed;
+      if( state.preloaded && patch.data && state.patch == patch ) off_time = 0; // Preloaded with our patch, so it goes first
+      else if( state.preloaded ) off_time = millis() - 1;                      // Preloaded for another note, so it goes last
+      if( off_time < oldest_off_time ){                                        // Is this the longest turned off note?
+        oldest_off_time = off_time;                                            // save the current time
         off_channel = ch;                                                      // save this as our longest off channel
       } 
     }
   }
 
-  if( off_channel < 0xFF ){                                                    // If it isn't FF, then we changed... so at least one channel is currently off.
-    return( off_channel );                                                     // Return the channel that has been off the longest
+  uint8_t ch = use_off ? off_channel : 0xFF;                                   // Use the channel that has been OFF the longest
+  if( ch == 0xFF ) ch = over_channel;                                          // Otherwise steal from an instrument over its reservation
+  if( ch == 0xFF && !own_only ) ch = off_channel;                              // or borrow a channel another instrument reserved
+  if( ch == 0xFF ) ch = on_channel;                                            // Last resort, the note that has been ON the longest
+  if( ch == 0xFF ) ch = off_channel;                                           // (limit too small for the patch, a 2x2OP patch on one voice)
+  if( ch == 0xFF ) ch = (skip == 0) ? 1 : 0;                                   // (every channel changed this millisecond)
+
+  if( channel_states[ch].note_state ){
+    if( channel_states[ch].inst < YM_MAX_INSTRUMENTS ) inst_states[ channel_states[ch].inst ].steals++; // Count the stolen note against its instrument
+    if( own_only ) stats.steals[YM_STEAL_LIMIT]++;                             // and why it had to go
+    else if( ch == over_channel ) stats.steals[YM_STEAL_OVER]++;
+    else stats.steals[YM_STEAL_OLDEST]++;
   }
-  return( on_channel );                                                        // Return the channel that has been ON the longest
+  chUnlink( ch );                                                              // Make sure it no longer belongs to a pair
+  return( ch );
+}
+
+void YM3812::chSetNoteState( uint8_t ch, bool on ){                            // Turn a channel's note on or off, keeping the voice counters up to date
+  YM_Channel &state = channel_states[ch];
+  if( state.note_state == on ) return;                                         // No change
+  state.note_state = on;
+  if( state.inst >= YM_MAX_INSTRUMENTS ) return;
+
+  YM_Instrument &inst = inst_states[ state.inst ];
+  if( on ){
+    if( ++voices_on > stats.voices_peak ) stats.voices_peak = voices_on;       // Keep track of the busiest it has been
+    if( inst.voices++ < inst.reserved ) reserved_free--;                       // Using up one of its reserved channels
+  } else {
+    voices_on--;
+    if( --inst.voices < inst.reserved ) reserved_free++;                       // Reserved channel is free again
+  }
+}
+
+void YM3812::chUnlink( uint8_t ch ){                                           // Break up a 2x2OP pair, releasing the other channel
+  uint8_t other = channel_states[ch].link;
+  if( other == 0xFF ) return;                                                  // Not part of a pair
+
+  if( channel_states[other].note_state ) chNoteOff( other );                   // Half a voice isn't much use, so turn the other one off
+  channel_states[other].link = channel_states[ch].link = 0xFF;                 // Neither channel is linked anymore
+}
+
+bool YM3812::chIdle( uint8_t ch ){                                             // True once a channel is off and its release has faded out
+  YM_Channel &state = channel_states[ch];
+  if( state.note_state ) return( false );                                      // Still playing
+  if( !state.patch.data ) return( true );                                      // Never played anything
+
+  uint8_t image[ PACKED_VOICE_SIZE ];
+  uint8_t rate = 0x0F;
+  patchCompile( state.patch, state.voice, image );
+  for( uint8_t op = 0; op<2; op++ ){                                           // The slowest carrier decides (modulators can't be heard)
+    if( !((image[PACKED_REG_C0] & 1) || (op==1)) ) continue;
+    uint8_t rr = image[1 + op * PACKED_OP_SIZE + PACKED_REG_80] & 0x0F;
+    if( rr < rate ) rate = rr;
+  }
+  if( rate == 0 ) return( false );                                             // Release rate 0 never fades out
+  return( millis() - state.state_changed >= (YM_RELEASE_TIME >> (rate - 1)) ); // Worst case time, key scaling only makes it quicker
+}
+
+void YM3812::chNoteOff( uint8_t ch ){                                          // Turn off the note on a channel
+  YM_Channel &state = channel_states[ch];
+  state.state_changed = millis();                                              // Save the time that the state changed
+  chSetNoteState( ch, false );                                                 // Indicate that the note is currently off
+  regKeyOn( ch, 0 );                                                           // Turn off the channel
+
+  int16_t peg = state.peg;
+  pegMoveTo( ch, pegLevel( state.patch[PATCH_PEG_REL_LEVEL] ), state.patch[PATCH_PEG_RELEASE] ); // Start the pitch envelope's release
+  if( state.peg != peg ) chSetPitch( ch );                                     // An instant release jumps straight to the new pitch
 }
 
 void YM3812::chSetPitch( uint8_t ch ){
   uint8_t block, fNumIndex;
-  uint8_t midiNote = channel_states[ch].midi_note+channel_states[ch].bend_note;// Calculate the midiNote based on the pitchBend data for the midi channel
+  int32_t pitch = (int32_t(channel_states[ch].midi_note) << 8) + channel_states[ch].bend; // 8.8 fixed point pitch: whole midi notes and 1/256ths of a semitone
+  pitch += channel_states[ch].detune * 8;                                      // Add the voice's fine tune (1/32nds of a semitone)
+  pitch += channel_states[ch].peg;                                             // And where the pitch envelope is at
+  pitch += channel_states[ch].lfo_vib;                                         // And the vibrato
+  pitch += channel_states[ch].glide;                                           // And the portamento
+
+  if( pitch < 0 ) pitch = 0;                                                   // If pitch bend went below midiNote zero, hold at the bottom
+  if( pitch > 0x7FFF ) pitch = 0x7FFF;                                         // (32 bits, so a wide bend on a high note can't wrap around)
+  uint8_t midiNote = pitch >> 8;                                               // Whole number of the note
+  uint8_t noteFrac = pitch & 0xFF;                                             // Fraction of the way to the next note
 
-  if( midiNote > 127 ) midiNote = 0;                                           // If midiNote wrapped around, then PB went below midiNote zero
   if( midiNote > 113 ) return;                                                 // Ignore any midi notes outside the range of the chip
   
   if( midiNote < 18 ){                                                         // For case where midi note is less than our repeating range
@@ -226,20 +1125,78 @@ void YM3812::chSetPitch( uint8_t ch ){
     fNumIndex = ((midiNote - 18) % 12) + 18;                                   // Calculate the fNum of the note
   }
 
-  uint16_t lFNum = FRQ_SCALE[fNumIndex];
-  uint16_t hFNum = FRQ_SCALE[fNumIndex+1];
-  uint16_t FNum = (uint32_t(hFNum - lFNum) * uint32_t(channel_states[ch].bend_rem)) / bend_note_size + lFNum;
+  uint16_t lFNum = pgm_read_word( &FRQ_SCALE[fNumIndex]   );
+  uint16_t hFNum = pgm_read_word( &FRQ_SCALE[fNumIndex+1] );
+  uint16_t FNum = ((uint16_t(hFNum - lFNum) * noteFrac) >> 8) + lFNum;          // Interpolate between the two notes
 
-  regFrqBlock( ch, block );                                                    // Send block number to chip
-  regFrqFnum(  ch, FNum  );                                                    // Send F-Number to chip
+  setFrequency( ch, block, FNum );                                             // Send block and F-Number to chip
 }
 
 void YM3812::chPlayNote( uint8_t ch ){                                         // Play a note on channel ch with pitch midiNote
   //Assumes that midi note and pitch bend properties were all set before running this function
+  uint8_t other = channel_states[ch].link;                                     // Second channel of a 2x2OP pair (0xFF if there isn't one)
+
   regKeyOn( ch, 0 );                                                           // Turn off the channel if it is on
-  chSendPatch( ch, *channel_states[ch].pPatch );                               // Send the patch to the YM3812
+  if( other != 0xFF ) regKeyOn( other, 0 );
+  if( channel_states[ch].preloaded ) chSendLevels( ch );                       // Patch is already there, only the levels are left
+  else chSendPatch( ch, channel_states[ch].patch );                            // Send the patch to the YM3812
+  channel_states[ch].preloaded = false;
+  if( other != 0xFF ) chSendPatch( other, channel_states[other].patch );       // (both voices go up before either one starts)
   chSetPitch( ch );                                                            // Set the pitch of the note (pitch info stored in channel_states array)
+  if( other != 0xFF ) chSetPitch( other );
   regKeyOn( ch, 1 );                                                           // Turn the channel back on
+  if( other != 0xFF ) regKeyOn( other, 1 );                                    // with the second voice right behind it
+}
+
+
+
+/************************
+* Register Functions    *
+************************/
+
+// setFrequency Theory of Operation:
+// The frequency of a channel is split across two registers. 0xA0 holds the lower 8 bits of the F-Number, and
+// 0xB0 holds the upper 2 bits along with the block and the key-on flag. Small pitch changes usually only move the
+// lower 8 bits, so we compare both bytes against the register cache and only send the ones that changed.
+// When both bytes change, the chip briefly plays a mix of the old and new values between the two writes. To keep
+// that from turning into an audible blip, we work out both possible in-between frequencies and write the bytes in
+// whichever order strays the least from the range between the old frequency and the new one.
+
+void YM3812::setFrequency( uint8_t ch, uint8_t block, uint16_t fnum ){
+  uint8_t valA0 = fnum & 0xFF;                                                 // Lower 8 bits of the F-Number
+  uint8_t valB0 = (reg_B0[ch] & 0b11100000) | ((block & 0b111) << 2) | ((fnum >> 8) & 0b11); // Keep key-on, replace block and upper F-Number bits
+
+  if( valA0 == reg_A0[ch] ){                                                   // If the lower byte didn't change...
+    stats.skipped_writes++;
+    if( valB0 != reg_B0[ch] ) sendData( 0xB0+ch, reg_B0[ch] = valB0 );        // Then we only need to send the upper byte (if it changed)
+    else stats.skipped_writes++;
+    return;
+  }
+  if( valB0 == reg_B0[ch] ){                                                   // If only the lower byte changed...
+    stats.skipped_writes++;
+    sendData( 0xA0+ch, reg_A0[ch] = valA0 );                                   // Then that's the only byte to send
+    return;
+  }
+
+  uint8_t  oldBlock = GET_BITS( reg_B0[ch], 0b00011100, 2 );                   // Both bytes changed, so work out the actual
+  uint16_t oldHigh  = uint16_t(reg_B0[ch] & 0b11) << 8;                        // frequencies (F-Number shifted by block) involved
+  uint32_t fOld   = uint32_t( oldHigh | reg_A0[ch] ) << oldBlock;              // Frequency currently playing
+  uint32_t fNew   = uint32_t( fnum ) << block;                                 // Frequency we are heading to
+  uint32_t fLowFirst  = uint32_t( oldHigh | valA0 ) << oldBlock;               // Frequency between writes if 0xA0 goes first
+  uint32_t fHighFirst = uint32_t( (fnum & 0x300) | reg_A0[ch] ) << block;      // Frequency between writes if 0xB0 goes first
+
+  uint32_t fMin = min( fOld, fNew );                                           // Range the frequency should stay inside
+  uint32_t fMax = max( fOld, fNew );
+  uint32_t errLowFirst  = (fLowFirst  < fMin) ? fMin - fLowFirst  : (fLowFirst  > fMax) ? fLowFirst  - fMax : 0;
+  uint32_t errHighFirst = (fHighFirst < fMin) ? fMin - fHighFirst : (fHighFirst > fMax) ? fHighFirst - fMax : 0;
+
+  if( errLowFirst <= errHighFirst ){
+    sendData( 0xA0+ch, reg_A0[ch] = valA0 );                                   // Lower byte first strays the least
+    sendData( 0xB0+ch, reg_B0[ch] = valB0 );
+  } else {
+    sendData( 0xB0+ch, reg_B0[ch] = valB0 );                                   // Otherwise the upper byte goes first
+    sendData( 0xA0+ch, reg_A0[ch] = valA0 );
+  }
 }
 
 
@@ -266,12 +1223,39 @@ void YM3812::reset(){
   reg_01 = reg_08 = reg_BD = 0;                                                // Clear out global settings
   for( uint8_t ch = 0; ch < YM3812_NUM_CHANNELS; ch++ ){                       // Loop through all of the channels
     reg_A0[ch] = reg_B0[ch] = 0;                                               // Set all register info to zero
+    reg_40[ch][0] = reg_40[ch][1] = 0;
   }
   regWaveset( 1 );                                                             // Enable all wave forms (not just sine waves)
 }
 
+int16_t YM3812::getRegister( uint8_t reg ){                                    // Read back a register cache (for tests checking it against the bus)
+  uint8_t ch = reg & 0x0F;
+  if( reg == 0x01 ) return( reg_01 );
+  if( reg == 0x08 ) return( reg_08 );
+  if( reg == 0xBD ) return( reg_BD );
+  if( (reg & 0xF0) == 0xA0 && ch < YM3812_NUM_CHANNELS ) return( reg_A0[ch] );
+  if( (reg & 0xF0) == 0xB0 && ch < YM3812_NUM_CHANNELS ) return( reg_B0[ch] );
+  for( ch = 0; ch < YM3812_NUM_CHANNELS; ch++ ){
+    if( reg == opReg( 0x40, ch, 0 ) ) return( reg_40[ch][0] );
+    if( reg == opReg( 0x40, ch, 1 ) ) return( reg_40[ch][1] );
+  }
+  return( -1 );
+}
+
+// sendData Theory of Operation:
+// Every register write in the class ends up here, so this is the one place to watch the bus. Each write is
+// counted (getBusWrites), which makes it easy to see when a change costs more writes than it used to, and
+// drives the bus load meter on the data LED (ledUpdate). With
+// YM_BUS_TRACE on, each write is also handed to ymBusTrace(), so the exact sequence of registers and values a
+// run of MIDI messages produces can be recorded (with micros() for the time) and compared against a known
+// good recording after changing something like chSendPatch, chSetPitch or chGetNext.
+
 void YM3812::sendData( uint8_t reg, uint8_t val ){
-  PORTD.OUTSET = DATA_LED;
+  PROFILE_ZONE( PROF_SEND_DATA );
+  stats.bus_writes++;
+  #if YM_BUS_TRACE
+    ymBusTrace( reg, val );                                                    // Record the write
+  #endif
 
   PORTD.OUTCLR = YM_CS;                                                        // Enable the chip
   PORTD.OUTCLR = YM_A0;                                                        // Put chip into register select mode
@@ -299,7 +1283,40 @@ void YM3812::sendData( uint8_t reg, uint8_t val ){
   delayMicroseconds(10);                                                       // Delay until the chip is ready to continue
 
   PORTD.OUTSET = YM_CS;                                                        // Bring Chip Select high to disable the YM3812
+}
 
-  PORTD.OUTCLR = DATA_LED;
+// Bus Load Meter Theory of Operation:
+// The data LED used to come on for each write, which showed that something was happening but not how much.
+// Now it shows how busy the bus is. Every YM_LED_WINDOW ticks, the writes sendData counted in the window are
+// turned into the share of the window they kept the bus busy (about YM_WRITE_TIME micros each), and the LED is
+// lit for that share of the ticks. Rather than lighting it in one block per window, the load is added to a
+// running total every tick and the LED is lit each time the total carries past 255, which spreads the lit
+// ticks out evenly so a light load glows dimly instead of flickering. Nothing extra happens on the write path:
+// the meter only reads the bus_writes counter. ledAlarm takes over the LED for YM_LED_ALARM slow, full on /
+// full off blinks, which no steady load looks like.
+
+void YM3812::ledUpdate(){                                                      // Show the bus load on the data LED
+  if( ++led_window >= YM_LED_WINDOW ){                                         // End of a window, work out its load
+    uint32_t busy   = (stats.bus_writes - led_writes) * YM_WRITE_TIME;         // Micros spent writing
+    uint32_t window = uint32_t(YM_LED_WINDOW) * 1000000 / control_rate;        // Micros in the window
+    led_load   = busy >= window ? 255 : busy * 255 / window;
+    led_writes = stats.bus_writes;
+    led_window = 0;
+  }
+
+  bool on;
+  if( led_alarm ){                                                             // Blinking takes over from the meter
+    led_alarm--;
+    on = (led_alarm / YM_LED_BLINK) & 1;
+  } else {
+    uint16_t level = led_level + led_load;                                     // Light the LED each time the total carries
+    on = (level >= 255);
+    led_level = on ? level - 255 : level;
+  }
+  if( on ) PORTD.OUTSET = DATA_LED;
+  else     PORTD.OUTCLR = DATA_LED;
+}
 
+void YM3812::ledAlarm(){                                                       // Blink the data LED to show something got lost
+  if( !led_alarm ) led_alarm = YM_LED_ALARM * 2 * YM_LED_BLINK;                // Let a blink run finish before starting another
 }
@@ -53,6 +53,36 @@ channel level (1 per channel x9).
 
 #define YM3812_NUM_CHANNELS  9                                                                    // Number of channels supported by the YM3812 chip
 #define YM3812_NUM_OPERATORS 18                                                                   // Number of channels for the YM3812 chip
+#define YM_MAX_INSTRUMENTS   16                                                                   // Number of instruments (midi channels) with their own settings
+#ifndef YM_BUS_TRACE
+  #define YM_BUS_TRACE       0                                                                    // Pass every register write to ymBusTrace() as well as the chip (see HostTest)
+#endif
+
+#if YM_BUS_TRACE
+  void ymBusTrace( uint8_t reg, uint8_t val );                                                    // Supplied by whoever records the trace (see sendData)
+#endif
+
+#define YM_RELEASE_TIME      39280UL                                                              // Time (ms) a release at rate 1 takes to fade out, each rate up halves it (see chIdle)
+#define YM_WRITE_TIME        42                                                                   // Time (micros) one register write holds the bus (see sendData)
+#define YM_LED_WINDOW        32                                                                   // Control ticks the bus load is measured over (see ledUpdate)
+#define YM_LED_BLINK         40                                                                   // Control ticks the data LED stays on or off in an alarm blink
+#define YM_LED_ALARM         4                                                                    // Number of blinks ledAlarm shows
+
+// Reasons a playing note got stolen (see chGetNext)
+#define YM_STEAL_LIMIT       0                                                                    // Instrument at its voice limit replaced one of its own notes
+#define YM_STEAL_OVER        1                                                                    // Taken from an instrument using more than its reservation
+#define YM_STEAL_OLDEST      2                                                                    // Nothing better left, so the oldest note went
+#define YM_STEAL_REASONS     3
+
+// Running totals kept by the class, so we can see how hard the module is working. Each one is a single
+// increment where it happens (the peak is a compare), and they only ever count up until resetStats().
+struct YM_Stats{
+  uint32_t      bus_writes     = 0;                                                               // Register writes sent to the chip
+  uint32_t      skipped_writes = 0;                                                               // Writes left out because the chip already had the value
+  uint32_t      patch_loads    = 0;                                                               // Patches sent to a channel (chSendPatch)
+  uint32_t      steals[YM_STEAL_REASONS] = {};                                                    // Notes stolen, by reason (YM_STEAL_*)
+  uint8_t       voices_peak    = 0;                                                               // Most channels playing at once
+};
 
 
 class YM3812 {                                                                                    // YM3812 Class
@@ -68,62 +98,163 @@ class YM3812 {
     uint8_t reg_A0[YM3812_NUM_CHANNELS]  = {0,0,0,0,0,0,0,0,0};                                   // frequency (lower 8-bits)
     uint8_t reg_B0[YM3812_NUM_CHANNELS]  = {0,0,0,0,0,0,0,0,0};                                   // key on, freq block, frequency (higher 2-bits)
 
+    // Operator Level Caches (18 bytes)
+    uint8_t reg_40[YM3812_NUM_CHANNELS][2];                                                       // Level scaling and level of each channel's operators
 
-    // Mapping
-    uint8_t op_map[YM3812_NUM_OPERATORS] = { 0,1,2,3,4,5,8,9,10,11,12,13,16,17,18,19,20,21 };     // Map Operator Index to Memory Offset
-    uint8_t channel_map[YM3812_NUM_CHANNELS] = { 0,1,2,6,7,8,12,13,14 };                          // Map channel index to operator 1's index. Add 3 to get operator 2's index.
+    YM_Stats stats;                                                                               // Statistics (see YM_Stats)
 
-    // Frequency Scale
-    const uint16_t FRQ_SCALE[31] = {                                                              // Midi Note Frequency scale
-      0x0AD, 0x0B7, 0x0C2, 0x0CD, 0x0D9, 0x0E6, 0x0F4, 0x102, 0x112, 0x122, 0x133, 0x145,
-      0x159, 0x16D, 0x183, 0x19A, 0x1B2, 0x1CC, 0x1E8, 0x205, 0x224, 0x244, 0x267, 0x28B,
-      0x2B2, 0x2DB, 0x306, 0x334, 0x365, 0x399, 0x3CF
-    };
+    // Bus Load Meter
+    uint32_t led_writes = 0;                                                                      // Bus writes when the current window started
+    uint8_t  led_window = 0;                                                                      // Control ticks into the current window
+    uint8_t  led_load   = 0;                                                                      // Share of the bus time spent writing in the last window (0-255)
+    uint8_t  led_level  = 0;                                                                      // Running total that spreads out the ticks the LED is lit
+    uint16_t led_alarm  = 0;                                                                      // Control ticks left of the alarm blink
 
     // Channel State Management
     uint8_t    num_channels = YM3812_NUM_CHANNELS;                                                // The nunber of channels in the YM3812
     YM_Channel channel_states[YM3812_NUM_CHANNELS];                                               // Data structure containing the state variables for each channel
     uint8_t    last_channel = 0;                                                                  // Contains the last updated channel
+    uint8_t    voices_on = 0;                                                                     // Number of channels playing a note
+    uint8_t    reserved_free = 0;                                                                 // Number of reserved channels that aren't being used by their instrument
+
+    // Instrument State Management
+    YM_Instrument inst_states[YM_MAX_INSTRUMENTS];                                                // Settings for each instrument (midi channel)
 
     // Pitch Bend
-    uint8_t  bend_note_offset = 2;                                                                // Default value is 2 for General MIDI's 4-note range
-    uint16_t bend_note_size   = PITCH_WHEEL_RANGE / 4;                                            // Default value for General MIDI's 4-note range
+    uint8_t  bend_note_offset = 2;                                                                // Semitones in each direction. Default value is 2 for General MIDI's 4-note range
+    int16_t  bendOffset( uint16_t pitchBend ){                                                    // Convert a pitch wheel value (0 ... 0x3FFF) into an 8.8 fixed point semitone offset
+      return( (int32_t(pitchBend) - 0x2000) * bend_note_offset >> 5 );                            // (pitchBend - center) / 0x2000 * offset * 256 without the division
+    }
+
+    // Pitch Envelopes
+    uint16_t control_rate = 500;                                                                  // Rate (Hz) of the control tick
+    uint8_t  control_ticks = 0;                                                                   // Number of control ticks so far (wraps around)
+    int16_t  pegLevel( uint8_t val ){                                                             // Convert a 7-bit signed quarter semitone patch value
+      return( int16_t( int8_t(val << 1) ) * 32 );                                                 // into an 8.8 fixed point semitone offset (* 32, as << on a negative value is undefined)
+    }
+    void     pegMoveTo( uint8_t ch, int16_t target, uint8_t time );                               // Start moving a channel's pitch envelope towards target
+    void     instSetLevels( uint8_t inst );                                                       // Recalculate an instrument's attenuation and rewrite carrier levels that changed
+    bool     monoNoteOn(  uint8_t inst, YM_Patch patch, uint8_t midiNote );                       // Add a held note to a mono instrument, true if the playing note took care of it
+    bool     monoNoteOff( uint8_t inst, uint8_t midiNote );                                       // Remove a held note from a mono instrument, true if it was handled
+    uint8_t  monoNote(    uint8_t inst );                                                         // The held note that should be playing, based on priority
+    uint8_t  monoChannel( uint8_t inst );                                                         // The channel still playing an instrument's mono voice (or 0xFF)
 
 
   public:
     YM3812();                                                                                     // Constructor
 
+    /***************************
+    * Register Addressing      *
+    ***************************/
+    // Operator registers are laid out in groups of 3 channels, each group 8 addresses apart. Operator 1 of a
+    // channel sits at ch%3 within its group and operator 2 is 3 addresses later. These are constexpr so the
+    // compiler folds the address down to a constant whenever the channel and operator are known at compile time.
+    static constexpr uint8_t opOffset( uint8_t ch, uint8_t op ){ return ((ch/3)<<3) + (ch%3) + op*3; }    // Memory offset of an operator (0-1) on a channel (0-8)
+    static constexpr uint8_t opReg( uint8_t reg, uint8_t ch, uint8_t op ){ return reg + opOffset(ch, op); } // Register address of an operator setting (0x20, 0x40, 0x60, 0x80, 0xE0)
+
     /***************************
     * Chip Control Functions   *
     ***************************/
     void reset();                                                                                 // Reset the sound procesor and all class settings
     void sendData(uint8_t reg, uint8_t val);                                                      // Send data to the sound processor
     void setBendRange(uint8_t wheelRange);                                                        // Adjust the range of the pitch wheel to the specified number of semitones
+    uint8_t getBendRange(){ return( bend_note_offset << 1 ); }                                    // Range of the pitch wheel in semitones
+    void setControlRate(uint16_t hz);                                                             // Tell the class how often (Hz) the control tick runs
+    void controlTick();                                                                           // Advance the control clock and LFOs (call once per tick, before any updates)
+    uint8_t getActiveVoices(){ return( voices_on ); }                                             // Number of channels playing a note right now
+    uint32_t getBusWrites(){ return( stats.bus_writes ); }                                        // Register writes sent to the chip since power on
+    const YM_Stats &getStats(){ return( stats ); }                                                // Statistics since power on (or resetStats)
+    void resetStats(){ stats = YM_Stats(); stats.voices_peak = voices_on; }                       // Start the statistics over
+    void ledUpdate();                                                                             // Show the bus load on the data LED (call once per control tick)
+    void ledAlarm();                                                                              // Blink the data LED to show something got lost
+    uint8_t getBusLoad(){ return( led_load ); }                                                   // Share of the bus time spent writing in the last window (0-255)
+    int16_t getRegister( uint8_t reg );                                                           // What the class thinks a register holds (-1 for registers it keeps no copy of)
 
     /***********************
     * Patch Functions      *
     ***********************/
-    void patchNoteOn(  PatchArr &patch, uint8_t midiNote, uint8_t velocity, uint16_t pitchBend ); // Passes pitchBend in addition to midi note
-    void patchNoteOn(  PatchArr &patch, uint8_t midiNote, uint8_t velocity );                     // Selects a channel and plays a midi note on it
-    void patchNoteOn(  PatchArr &patch, uint8_t velocity ){                                       // If no midiNote is specified, then use the default note for the patch
+    void patchNoteOn(  YM_Patch patch, uint8_t midiNote, uint8_t velocity, uint16_t pitchBend, uint8_t inst ); // Plays the note using the settings of instrument inst
+    void patchNoteOn(  YM_Patch patch, uint8_t midiNote, uint8_t velocity, uint16_t pitchBend ){ // Passes pitchBend in addition to midi note
+      patchNoteOn( patch, midiNote, velocity, pitchBend, 0 );
+    }
+    void patchNoteOn(  YM_Patch patch, uint8_t midiNote, uint8_t velocity );                      // Selects a channel and plays a midi note on it
+    void patchNoteOn(  YM_Patch patch, uint8_t velocity ){                                        // If no midiNote is specified, then use the default note for the patch
       patchNoteOn(  patch, patch[PATCH_NOTE_NUMBER], velocity); 
     }
 
-    void patchNoteOff( PatchArr &patch, uint8_t midiNote );                                       // Turns off any channel playing the midi note
-    void patchNoteOff( PatchArr &patch ){ patchNoteOff( patch, patch[PATCH_NOTE_NUMBER]); }       // Turns off any channel playing the midi note
+    void patchPreload( YM_Patch patch );                                                          // Send a patch to a free channel ahead of a note that will use it
+    void patchNoteOff( YM_Patch patch, uint8_t midiNote );                                        // Turns off any channel playing the midi note
+    void patchNoteOff( YM_Patch patch ){ patchNoteOff( patch, patch[PATCH_NOTE_NUMBER]); }        // Turns off any channel playing the midi note
+
+    void patchAllOff(  YM_Patch patch );                                                          // Turns off any channel playing a specific patch
+    void patchUpdate(  YM_Patch patch );                                                          // Updates any channels playing a patch with the current values
+    void patchUpdateField( YM_Patch patch, uint8_t field );                                       // Updates channels playing a patch after one field (PATCH_*) changed
+
+    bool patchInUse(   YM_Patch patch );                                                          // True while any channel can still be heard playing the patch
+    void patchForget(  YM_Patch patch );                                                          // Drop the patch from silent channels (before its data gets reused)
+
+    void patchPitchBend( YM_Patch patch, uint16_t pitchBend);                                     // Adjust all notes associated with the patch based on pitchBend value
+    static void patchCompile( YM_Patch patch, uint8_t voice, uint8_t *image );                    // Fill image with the register values (PACKED_VOICE_SIZE bytes) for one voice of a patch
 
-    void patchAllOff(  PatchArr &patch );                                                         // Turns off any channel playing a specific patch
-    void patchUpdate(  PatchArr &patch );                                                         // Updates any channels playing a patch with the current values
+    /***********************
+    * Instrument Functions *
+    ***********************/
+    void instNoteOff(    uint8_t inst, uint8_t midiNote );                                        // Turns off any channel playing the midi note on the instrument
+    void instAllOff(     uint8_t inst );                                                          // Turns off every note on the instrument (including held mono notes)
+    void instPitchBend(  uint8_t inst, uint16_t pitchBend );                                      // Adjust all notes playing on the instrument based on pitchBend value
+    void instSetVelocityCurve( uint8_t inst, uint8_t curve );                                     // Select the velocity curve (VEL_CURVE_*) used by an instrument
+    void instSetVolume(    uint8_t inst, uint8_t val );                                           // Set the channel volume (CC7) and update notes that are playing
+    void instSetExpression( uint8_t inst, uint8_t val );                                          // Set the expression (CC11) and update notes that are playing
+    void instSwapPatch( uint8_t inst, YM_Patch from, YM_Patch to );                               // Point the instrument's notes playing one patch at another copy of it
+    void instSetMaxVoices( uint8_t inst, uint8_t voices );                                        // Limit the channels an instrument can use at once (0 = no limit)
+    void instSetReservedVoices( uint8_t inst, uint8_t voices );                                   // Keep some channels free for an instrument
+    uint16_t instGetSteals( uint8_t inst ){ return( inst < YM_MAX_INSTRUMENTS ? inst_states[inst].steals : 0 ); } // Number of the instrument's notes that were stolen
+    void instSetMono(      uint8_t inst, bool on );                                               // Turn mono mode on or off (turns off the instrument's notes)
+    void instSetMonoPriority( uint8_t inst, uint8_t priority );                                   // Select which held note plays in mono mode (MONO_*)
+    void instSetGlide(     uint8_t inst, bool on );                                               // Turn portamento on or off (CC65)
+    void instSetGlideTime( uint8_t inst, uint8_t val );                                           // Set the portamento time (CC5)
+    void instSetModWheel(  uint8_t inst, uint8_t val );                                           // Set the mod wheel position (scales LFO depth)
+    void instSetLfoRate(   uint8_t inst, uint8_t val );                                           // Set the LFO speed (0 - 127)
+    void instSetLfoDepth(  uint8_t inst, uint8_t val );                                           // Set the LFO depth at full mod wheel (0 - 127)
+    void instSetLfoDelay(  uint8_t inst, uint8_t val );                                           // Set the time the LFO takes to fade in (0 - 127)
+    void instSetLfoWave(   uint8_t inst, uint8_t wave );                                          // Select the LFO waveform (LFO_*)
+
+
+    /***********************
+    * Pitch Envelope       *
+    ***********************/
+    void     pegUpdate( uint8_t ch );                                                             // Step the pitch envelope of a channel (call once per control tick)
+
+    /***********************
+    * Portamento           *
+    ***********************/
+    void     glideUpdate( uint8_t ch );                                                           // Step a channel's portamento (call once per control tick)
+
+    /***********************
+    * LFO                  *
+    ***********************/
+    void     lfoSetSens( uint8_t ch );                                                            // Look up a channel's vibrato and tremolo sensitivities from its patch
+    void     lfoStart(  uint8_t ch );                                                             // Reset a channel's LFO fade in and sensitivities for a new note
+    void     lfoUpdate( uint8_t ch );                                                             // Apply the instrument's LFO to a channel (call once per control tick)
 
-    void patchPitchBend( PatchArr &patch, uint16_t pitchBend);                                    // Adjust all notes associated with the patch based on pitchBend value
 
     /***********************
     * Channel Functions    *
     ***********************/
-    uint8_t chGetNext();                                                                          // Return the next available channel
+    uint8_t chGetNext( uint8_t skip = 0xFF, uint8_t inst = 0xFF, YM_Patch patch = YM_Patch() );   // Return the next available channel for inst (other than skip), preferring one preloaded with patch
+    void    chSetNoteState( uint8_t ch, bool on );                                                // Turn a channel's note state on or off and update the voice counters
+    void    chNoteOff( uint8_t ch );                                                              // Turn off the note playing on a channel and start its release
+    void    chUnlink( uint8_t ch );                                                               // Release the other half of a 2x2OP pair so ch can be reused
+    bool    chIdle( uint8_t ch );                                                                 // True once a channel is off and its release has faded out
     void    chPlayNote( uint8_t ch );                                                             // Play a midi note associated with ch in the channel_states array
     void    chSetPitch( uint8_t ch );                                                             // Set the pitch of a note based on info in channel_states array  
-    void    chSendPatch( uint8_t ch, PatchArr &patch );                                           // Update channel on YM3812 with patch information
+    void    chSendPatch( uint8_t ch, YM_Patch patch );                                            // Update channel on YM3812 with patch information
+    void    chSendLevels( uint8_t ch );                                                           // Send only the operator levels of the channel's patch (for the note's velocity)
+    void    chGlideTo( uint8_t ch, uint8_t midiNote );                                            // Slide a playing note (and its pair) to a new midi note without retriggering
+    void    chUpdateField( uint8_t ch, uint8_t field );                                           // Rewrite the one register holding a patch field (PATCH_*) on a channel
+    uint8_t chOpLevel( uint8_t ch, uint8_t op, uint8_t reg40, bool carrier );                     // Work out the 0x40 register value of an operator (velocity and attenuation)
+    void    chSetLevels( uint8_t ch );                                                            // Resend the carrier levels of a channel (only the ones that changed)
+    uint8_t chAttenuation( uint8_t ch );                                                          // Extra attenuation (level steps) applied to a channel's carriers
 
 
     /***********************
@@ -144,6 +275,7 @@ class YM3812 {
       sendData(  0xA0+ch, SET_BITS( reg_A0[ch], 0b11111111, 0, frequency & 0xFF ) );                                      // Lower 8 bits of left channel's frequency number
       sendData(  0xB0+ch, SET_BITS( reg_B0[ch], 0b00000011, 0, frequency >> 8 )   );                                      // Upper 2 bits of left channel's frequency number
     }
+    void setFrequency(       uint8_t ch, uint8_t block, uint16_t fnum );                                                  // Set block and F-Number together, only sending the register bytes that changed
 
 };
 
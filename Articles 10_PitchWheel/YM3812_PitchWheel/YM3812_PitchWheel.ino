@@ -57,7 +57,14 @@ YM3812 Chip Select | PD4     UPDI | UPDI Port
 #include "Arduino.h"
 #include "YM3812.h"
 #include "YMDefs.h"
+#include "ControlTick.h"
+#include "MidiParser.h"
+#include "UserBank.h"
+#include "PerfStore.h"
+#include "SmfPlayer.h"
+#include "Profiler.h"
 #include "instruments.h"
+#include "songs.h"
 #include <MIDI.h>
 #include <SPI.h>
 
@@ -77,52 +84,256 @@ YM3812  PROC_YM3812;                                                           /
 #define  MAX_INSTRUMENTS   16                                                  // Total MIDI instruments to support (one per midi channel)
 
 uint8_t  inst_patch_index[ MAX_INSTRUMENTS ];                                  // Contains index of the patch used for each midi instrument / channel
-PatchArr inst_patch_data[  MAX_INSTRUMENTS ];                                  // Contains one patch per instrument
+YM_Patch inst_patch[       MAX_INSTRUMENTS ];                                  // Handle to the patch used by each instrument (flash, or RAM once edited)
 
-void loadPatchFromProgMem( byte instIndex, byte patchIndex ){                  // Load patch data from program memory into inst_patch_data array
-  for( byte i=0; i<PATCH_SIZE; i++ ){                                          // Loop through instrument data
-    inst_patch_data[instIndex][i] = pgm_read_byte_near( patches[patchIndex]+i ); // Copy each byte into ram_data
+YM_Patch bankPatch( byte patchIndex ){                                         // Get a handle to a patch in the packed bank (see instruments.h)
+  return( YM_Patch( ym_bank + pgm_read_word( &ym_bank_index[patchIndex] ), PATCH_TYPE_PACKED ) ); // Look up where the patch starts
+}
+
+
+/*******************************************
+ * User Patch Bank                         *
+ *******************************************/
+// Patches stored with the SysEx Store command live in a bank in flash (see UserBank.h) and take the place of
+// the factory patch with the same program number. Stores only change a RAM page buffer; the page gets written
+// by userBankService once nothing is playing and MIDI has been quiet for a while, since the CPU stalls for the
+// whole page erase and write. A write that fails is tried again after USER_BANK_RETRY, rather than on every
+// pass of the loop (UserBank gives up after a few). The buffer only holds one page, so a Store to another page
+// while one is waiting writes that one out first (userBankStore), stall or not, rather than losing the Store.
+
+#define  USER_BANK_QUIET   2000                                                // Milliseconds without notes before a flash write is allowed
+#define  USER_BANK_RETRY   10000                                               // Milliseconds to wait after a failed flash write
+
+UserBank USER_BANK;                                                            // Patches stored in flash
+unsigned long last_note_time = 0;                                              // millis() of the last note on or off
+unsigned long user_bank_failed = 0;                                            // millis() of the last failed flash write
+
+void userBankService(){                                                        // Write out stored patches when it can't be heard
+  if( !USER_BANK.pending() ) return;
+  if( PROC_YM3812.getActiveVoices() > 0 ) return;                              // Something is still sounding
+  if( millis() - last_note_time < USER_BANK_QUIET ) return;                    // Probably just between notes
+  if( USER_BANK.getFailures() && millis() - user_bank_failed < USER_BANK_RETRY ) return; // Give the flash a rest
+  if( !USER_BANK.flush() ) user_bank_failed = millis();
+}
+
+bool userBankStore( byte program, byte instIndex ){                            // Store an instrument's patch in the user bank
+  if( USER_BANK.store( program, inst_patch[instIndex] ) ) return( true );
+  if( !USER_BANK.pending() ) return( false );                                  // Bank is full (or can't be written)
+  if( !USER_BANK.flush() ){                                                    // Another page is waiting, write it out now
+    user_bank_failed = millis();
+    return( false );
   }
+  return( USER_BANK.store( program, inst_patch[instIndex] ) );
+}
+
+void loadPatchFromProgMem( byte instIndex, byte patchIndex ){                  // Point an instrument at a patch in program memory
+  YM_Patch user = USER_BANK.patch( patchIndex );                               // A stored user patch wins over the factory one
+  inst_patch[instIndex] = user.data ? user : bankPatch( patchIndex );          // No copy needed, the handle reads straight from flash
 }
 
 #define  DRUM_CHANNEL      10                                                  // The MIDI channel to use for drums
 #define  FIRST_DRUM_NOTE   35                                                  // Conforming to GM patch standard, notes [35-81]
 
-PatchArr drum_patch_data[ NUM_DRUMS ];                                         // Patch data for the drums
+uint8_t drumNoteIndex( byte midiNote ){                                        // Drum played by a note on the drum channel
+  return( (midiNote + NUM_DRUMS - FIRST_DRUM_NOTE % NUM_DRUMS) % NUM_DRUMS );  // Notes outside the range wrap around (without going negative below 35)
+}
+
 uint8_t  drum_patch_index[ NUM_DRUMS ];                                        // Array that translates between drum index and drum patchIndex (allows reassignment)
 
-void loadDrumPatchFromProgMem( byte trackIndex, byte patchIndex ){             // Load a patch from program memory into drum_patach_data
-  for( byte i=0; i<PATCH_SIZE; i++ ){                                          // Loop through instrument data
-    drum_patch_data[trackIndex][i] = pgm_read_byte_near( patches[patchIndex+NUM_MELODIC] + i ); // Copy each byte into ram_data
-  }                                                                            // Worth noting that drum patches are stored after instrument
-}                                                                              // patches, hence why we add NUM_PATCHES
+YM_Patch drumPatch( byte drumIndex ){                                          // Get a handle to the patch for a drum
+  return( bankPatch( drum_patch_index[drumIndex] + NUM_MELODIC ) );            // Drum patches are stored after the melodic patches,
+}                                                                              // hence why we add NUM_MELODIC
+
+
+/*******************************************
+ * Patch Editing Pool                      *
+ *******************************************/
+// Patches are read straight out of flash until someone wants to change one. At that point the patch gets
+// copied into a slot in this small RAM pool and the instrument's handle is pointed at the copy. Slots are
+// handed back automatically when the instrument loads a different patch, but only once no channel can still be
+// heard playing it (a release tail, say). Channels still holding a handle to a slot that gets reused are told to
+// forget it, so they don't pick up the new contents. Patches uploaded over SysEx land in the pool too, so it has
+// room for every instrument (a whole bank upload), plus one more. An upload only replaces the instrument's patch
+// once its checksum adds up, so it needs a free slot even when every instrument already has one.
+
+#define  PATCH_POOL_SIZE   (MAX_INSTRUMENTS + 1)                               // Number of patches that can be edited at the same time
+
+PatchArr patch_pool[ PATCH_POOL_SIZE ];                                        // RAM copies of patches that are being edited
+uint8_t *pool_reserved = NULL;                                                 // Slot being filled by a SysEx upload (not free, but no instrument has it yet)
+
+uint8_t *poolSlot(){                                                           // Find a slot that nothing is using (NULL if the pool is full)
+  for( byte slot=0; slot<PATCH_POOL_SIZE; slot++ ){
+    bool used = (patch_pool[slot] == pool_reserved);
+    for( byte i=0; i<MAX_INSTRUMENTS; i++ ) used |= (inst_patch[i].data == patch_pool[slot]);
+    if( used || PROC_YM3812.patchInUse( YM_Patch( patch_pool[slot] ) ) ) continue; // Still sounding on a channel
+    PROC_YM3812.patchForget( YM_Patch( patch_pool[slot] ) );                   // Silent channels let go of it
+    return( patch_pool[slot] );
+  }
+  return( NULL );                                                              // No free slots
+}
+
+uint8_t *editPatch( byte instIndex ){                                          // Get a writable copy of an instrument's patch (NULL if the pool is full)
+  if( inst_patch[instIndex].type == PATCH_TYPE_RAM ) return( (uint8_t *)inst_patch[instIndex].data ); // Already in RAM, so edit it in place
+
+  uint8_t *slot = poolSlot();
+  if( !slot ) return( NULL );
+
+  for( byte i=0; i<PATCH_SIZE; i++ ) slot[i] = inst_patch[instIndex][i];       // Copy (and unpack) the patch out of flash
+  inst_patch[instIndex] = YM_Patch( slot, PATCH_TYPE_RAM );                    // And point the instrument at the copy
+  return( slot );
+}
+
+void editPatchField( byte instIndex, byte field, byte val ){                   // Change one field of an instrument's patch, including notes already playing
+  if( field >= PATCH_SIZE ) return;
+  YM_Patch original = inst_patch[instIndex];
+  uint8_t *patch = editPatch( instIndex );                                     // Copy the patch into RAM (if it isn't already)
+  if( !patch ) return;                                                         // Pool is full, nowhere to put the change
+
+  if( inst_patch[instIndex] != original ){                                     // Patch was just copied, so move the notes
+    PROC_YM3812.instSwapPatch( instIndex, original, inst_patch[instIndex] );   // playing it over to the copy
+  }
+  if( patch[field] == val ) return;                                            // No change
+  patch[field] = val;
+  PROC_YM3812.patchUpdateField( inst_patch[instIndex], field );                // Only rewrites the register holding the field
+}
+
+
+/*******************************************
+ * Performance Memory                      *
+ *******************************************/
+// The patch chosen for each channel, the bend range and the drum map are kept in EEPROM (see PerfStore.h), so
+// the module comes back up the way it was left. Anything that changes them calls perfChanged with the byte of
+// the record that changed; PerfStore writes it out in the background once the changes stop. A value that is the
+// same as the one in the record (a host that resends its program changes every so often) isn't a change, so it
+// doesn't cost an EEPROM write. Changes made while perf_hold is set (by the song player) aren't recorded at all,
+// so a song can't replace the setup the player chose.
+
+#define  PERF_VERSION      1                                                   // Bump when the record layout changes (old records are then ignored)
+#define  PERF_BEND         MAX_INSTRUMENTS                                     // Record layout: patch index of each instrument, then the bend range,
+#define  PERF_DRUMS        (PERF_BEND + 1)                                     // then the drum map
+#define  PERF_SIZE         (PERF_DRUMS + NUM_DRUMS)                            // Bytes in the record
+
+PerfStore PERFORMANCE;                                                         // Saves the record to EEPROM
+uint8_t  perf_record[ PERF_SIZE ];                                             // The performance setup as it gets saved
+bool     perf_hold = false;                                                    // Changes aren't recorded (the song player is in charge)
+
+void perfChanged( uint8_t pos, uint8_t val ){                                  // A byte (PERF_*) of the performance setup changed
+  if( perf_hold || perf_record[pos] == val ) return;                           // Not ours to keep, or nothing new
+  perf_record[pos] = val;
+  PERFORMANCE.changed();
+}
+
+void perfRestore(){                                                            // Load the saved setup over the defaults (if there is one)
+  memcpy( perf_record, inst_patch_index, MAX_INSTRUMENTS );                    // Start from the defaults, so changes are compared
+  perf_record[PERF_BEND] = PROC_YM3812.getBendRange();                         // against what is really in use
+  memcpy( perf_record + PERF_DRUMS, drum_patch_index, NUM_DRUMS );
+  if( !PERFORMANCE.begin( perf_record, PERF_SIZE, PERF_VERSION ) ) return;
+  memcpy( inst_patch_index, perf_record, MAX_INSTRUMENTS );
+  PROC_YM3812.setBendRange( perf_record[PERF_BEND] );
+  memcpy( drum_patch_index, perf_record + PERF_DRUMS, NUM_DRUMS );
+}
 
 uint16_t inst_pitch_bend[ MAX_INSTRUMENTS ];                                    // holds current pitch bend value
 
 
+/*******************************************
+ * Pitch Bend Coalescing                   *
+ *******************************************/
+// Controllers can send pitch bend messages far faster than we can push the new frequencies out to the YM3812.
+// Rather than updating the chip on every message, we latch the most recent value for each midi channel and
+// apply whatever has changed on the next control tick. Anything that arrived in between is simply skipped.
+
+uint16_t      bend_pending = 0;                                                // One bit per midi channel that has a new pitch bend value waiting
+uint32_t      pitch_bend_received = 0;                                         // Number of pitch bend messages received
+uint32_t      pitch_bend_applied  = 0;                                         // Number of pitch bend values actually applied to the YM3812
+
+void applyPitchBends(){                                                        // Send any latched pitch bend values to the YM3812
+  if( !bend_pending ) return;                                                  // Nothing has changed
+  for( byte ch=0; ch<MAX_INSTRUMENTS; ch++ ){                                  // Loop through each of the midi channels
+    if( ch == DRUM_CHANNEL - 1 ) continue;                                     // Drums don't bend
+    if( bend_pending & (1U << ch) ){                                           // If the channel has a new value waiting...
+      PROC_YM3812.instPitchBend( ch, inst_pitch_bend[ch] );                    // Update pitch of any currently playing notes
+      pitch_bend_applied++;
+    }
+  }
+  bend_pending = 0;                                                            // Everything has been applied
+}
+
+
+/*******************************************
+ * Control Tick                            *
+ *******************************************/
+// Everything that has to happen at a regular rate runs as a task on the control tick (see ControlTick.h).
+// Tick tasks run every tick, voice tasks run once per YM3812 channel, taking turns when a tick runs out of time.
+
+#define  CONTROL_RATE      500                                                 // Rate (Hz) of the control tick
+#define  CONTROL_BUDGET    500                                                 // Time (micros) each tick can spend on voice tasks
+#define  CONTROL_REPORT    0                                                   // Seconds between statistics reports on Serial (0 = off)
+
+ControlTick CONTROL;                                                           // Instantiate the control tick scheduler
+
+void clockTask(){ PROC_YM3812.controlTick(); }                                 // Keep the YM3812 class in step with the tick
+void pegTask( uint8_t ch ){ PROC_YM3812.pegUpdate( ch ); }                     // Step the pitch envelope of a channel
+void glideTask( uint8_t ch ){ PROC_YM3812.glideUpdate( ch ); }                 // Step the portamento of a channel
+void lfoTask( uint8_t ch ){ PROC_YM3812.lfoUpdate( ch ); }                     // Apply the vibrato / tremolo of a channel
+
+
 /*******************************************
  * MIDI Definition                         *
  *******************************************/
+// Incoming MIDI can be decoded either by the MIDI library (callbacks) or by MidiParser (events handed to
+// handleMidiEvent below). Both end up calling the same handle* functions.
+
+#define  MIDI_PARSER       1                                                   // Use MidiParser (1) or the MIDI library (0)
+#ifndef SMF_PLAYER
+  #define SMF_PLAYER       0                                                   // Play demo_song on a loop by itself (see Song Player)
+#endif
 
-MIDI_CREATE_INSTANCE( HardwareSerial, Serial2, MIDI );                         // Create an instance of MIDI library running on Serial port 2
+#if MIDI_PARSER
+  MidiParser MIDI_IN;                                                          // Running status parser reading Serial port 2
+#else
+  MIDI_CREATE_INSTANCE( HardwareSerial, Serial2, MIDI );                       // Create an instance of MIDI library running on Serial port 2
+#endif
 
 #define RPNMSB  101                                                            // Command ID for RPN Command's Most Significant Byte
 #define RPNLSB  100                                                            // Command ID for RPN Command's Least Significant Byte
 #define DATAMSB 6                                                              // Command ID for RPN Value's Most Significant Byte
 #define DATALSB 38                                                             // Command ID for RPN Value's Least Significant Byte
+#define NRPNMSB 99                                                             // Command ID for NRPN Command's Most Significant Byte
+#define NRPNLSB 98                                                             // Command ID for NRPN Command's Least Significant Byte (patch field, see PATCH_* in YMDefs.h)
+#define VELCURVE 9                                                             // Undefined CC used to select the velocity curve (0-31 Linear, 32-63 Exp, 64-95 Log, 96-127 Fixed)
+#define MODWHEEL 1                                                             // Modulation wheel, scales the depth of the LFO
+#define GLIDETIME 5                                                            // Portamento time
+#define GLIDE    65                                                            // Portamento on (64-127) / off (0-63)
+#define MONOPRIO 15                                                            // Undefined CC used to select mono note priority (0-42 Last, 43-85 Low, 86-127 High)
+#define MONOON   126                                                           // Mono mode on
+#define POLYON   127                                                           // Poly mode on (mono mode off)
+#define SOUNDOFF 120                                                           // All sound off
+#define NOTESOFF 123                                                           // All notes off
+#define MAXVOICES 20                                                           // Undefined CC used to limit an instrument's polyphony (0 = no limit)
+#define RESERVE  21                                                            // Undefined CC used to reserve channels for an instrument
+#define VOLUME   7                                                             // Channel volume
+#define EXPRESSION 11                                                          // Expression (a second volume control, for swells)
+#define LFOWAVE  14                                                            // Undefined CC used to select the LFO waveform (0-31 Sine, 32-63 Triangle, 64-95 Square, 96-127 Saw)
+#define LFORATE  76                                                            // Sound Controller 7 (Vibrato Rate)
+#define LFODEPTH 77                                                            // Sound Controller 8 (Vibrato Depth)
+#define LFODELAY 78                                                            // Sound Controller 9 (Vibrato Delay)
 
 uint16_t RPN_command = 0x7F7F;                                                 // Holds the current RPN command while bytes are coming in
+uint16_t NRPN_command = 0x3FFF;                                                // Holds the current NRPN command (NRPN 0:n edits field n of the channel's patch)
 
 
 void handleNoteOn( byte channel, byte midiNote, byte velocity ){               // Handle MIDI Note On Events
   uint8_t ch = channel - 1;                                                    // Convert to 0-indexed from MIDI's 1-indexed channel nonsense
   uint8_t drumIndex;
+  last_note_time = millis();                                                   // Holds off user bank writes
 
   if( DRUM_CHANNEL == channel ){                                               // See if the note being played is on the drum channel
-    drumIndex = (midiNote - FIRST_DRUM_NOTE) % NUM_DRUMS;                      // Calculate the index of the drum based on the midi note
-    PROC_YM3812.patchNoteOn( drum_patch_data[drumIndex], velocity );           // Play the drum patch
+    drumIndex = drumNoteIndex( midiNote );                                     // Calculate the index of the drum based on the midi note
+    YM_Patch drum = drumPatch( drumIndex );                                    // Get the patch for the drum
+    PROC_YM3812.patchNoteOn( drum, drum[PATCH_NOTE_NUMBER], velocity, 0x2000, ch ); // Play the drum patch
   } else {                                                                     // If not a drum channel
-    PROC_YM3812.patchNoteOn( inst_patch_data[ch], midiNote, velocity, inst_pitch_bend[ch]); // Pass the patch information for the channel and note to the YM3812
+    PROC_YM3812.patchNoteOn( inst_patch[ch], midiNote, velocity, inst_pitch_bend[ch], ch ); // Pass the patch information for the channel and note to the YM3812
   }
 
 }
@@ -130,12 +341,13 @@ void handleNoteOn( byte channel, byte midiNote, byte velocity ){               /
 void handleNoteOff( byte channel, byte midiNote, byte velocity ){              // Handle MIDI Note Off Events
   uint8_t ch = channel - 1;                                                    // Convert to 0-indexed from MIDI's 1-indexed channel nonsense
   uint8_t drumIndex;
+  last_note_time = millis();                                                   // Holds off user bank writes
 
   if( DRUM_CHANNEL == channel ){                                               // See if the note being played is on the drum channel
-    drumIndex = (midiNote - FIRST_DRUM_NOTE) % NUM_DRUMS;                      // Calculate the index of the drum based on the midi note
-    PROC_YM3812.patchNoteOff( drum_patch_data[drumIndex] );                    // Turn off the drum patch
+    drumIndex = drumNoteIndex( midiNote );                                     // Calculate the index of the drum based on the midi note
+    PROC_YM3812.patchNoteOff( drumPatch( drumIndex ) );                        // Turn off the drum patch
   } else {                                                                     // If not a drum channel
-    PROC_YM3812.patchNoteOff( inst_patch_data[ch], midiNote );                 // Pass the patch information for the channel and note to the YM3812
+    PROC_YM3812.instNoteOff( ch, midiNote );                                   // Turn off the note on the channel's instrument
   }
 
 }
@@ -143,24 +355,356 @@ void handleNoteOff( byte channel, byte midiNote, byte velocity ){              /
 void handleProgramChange( byte channel, byte patchIndex ){
   uint8_t ch = channel-1;                                                      // Convert to 0-indexed from MIDI's 1-indexed channel nonsense
   inst_patch_index[ch] = patchIndex;                                           // Store the patch index
-  loadPatchFromProgMem( ch, inst_patch_index[ch] );                            // Load the patch from progmem into regular memory
+  loadPatchFromProgMem( ch, inst_patch_index[ch] );                            // Point the instrument at the patch in progmem
+  perfChanged( ch, patchIndex );                                               // Remember it over a power cycle
 }
 
 void handlePitchBend( byte channel, int16_t pitchBend ){
   uint8_t ch = channel-1;                                                      // Convert to 0-indexed from MIDI's 1-indexed channel nonsense
   inst_pitch_bend[ch] = pitchBend + 0x2000;                                    // Shift pitchBend value by 0x2000 so it is always positive (and runs 0 ... 0x3FFF)
-  PROC_YM3812.patchPitchBend( inst_patch_data[ch], inst_pitch_bend[ch]);       // Update pitch of any currently playing notes
+  bend_pending |= (1U << ch);                                                  // Flag the channel so the value gets applied on the next update
+  pitch_bend_received++;
 }
 
 void handleControlChange( byte channel, byte command, byte val ){              // Respond to ControlChange commands so we can pick out RPN commands
   switch( command ){
-    case RPNMSB:  RPN_command = (RPN_command & 0x007F) | (val << 7);    break; // Capture the MSB value in bits 7 through 13 of RPN_command
-    case RPNLSB:  RPN_command = (RPN_command & 0xFF80) | val;           break; // Capture the LSB value in bits 0 through 6 of RPN_command
-    case DATAMSB: if( RPN_command==0 ) PROC_YM3812.setBendRange( val ); break; // Check if command is pitch bend sensitivity and then send value to YM3812 library
+    case RPNMSB:  RPN_command = (RPN_command & 0x007F) | (val << 7);    NRPN_command = 0x3FFF; break; // Capture the MSB value in bits 7 through 13 of RPN_command
+    case RPNLSB:  RPN_command = (RPN_command & 0xFF80) | val;           NRPN_command = 0x3FFF; break; // Capture the LSB value in bits 0 through 6 of RPN_command
+    case NRPNMSB: NRPN_command = (NRPN_command & 0x007F) | (val << 7);  RPN_command = 0x7F7F;  break; // Selecting an NRPN deselects the RPN (and the other way around)
+    case NRPNLSB: NRPN_command = (NRPN_command & 0xFF80) | val;         RPN_command = 0x7F7F;  break;
+    case DATAMSB:
+      if( RPN_command==0 ){                                                    // Check if command is pitch bend sensitivity and then send value to YM3812 library
+        PROC_YM3812.setBendRange( val );
+        perfChanged( PERF_BEND, PROC_YM3812.getBendRange() );
+      }
+      else if( NRPN_command < PATCH_SIZE ) editPatchField( channel-1, NRPN_command, val ); // Patch field edit
+      break;
     case DATALSB:                                                       break; // LSB sets range to less than a semitone. We can ignore that
+    case VELCURVE: PROC_YM3812.instSetVelocityCurve( channel-1, val >> 5 ); break; // Split the CC range into one zone per velocity curve
+    case MODWHEEL: PROC_YM3812.instSetModWheel( channel-1, val );       break; // LFO depth follows the mod wheel
+    case GLIDETIME: PROC_YM3812.instSetGlideTime( channel-1, val );     break; // Time to slide between notes
+    case GLIDE:    PROC_YM3812.instSetGlide( channel-1, val >= 64 );    break; // Held notes slide to new ones instead of retriggering
+    case MONOPRIO: PROC_YM3812.instSetMonoPriority( channel-1, val / 43 ); break; // Split the CC range into one zone per priority
+    case MONOON:   PROC_YM3812.instSetMono( channel-1, true );          break; // One note at a time on a single YM3812 channel
+    case POLYON:   PROC_YM3812.instSetMono( channel-1, false );         break;
+    case SOUNDOFF:                                                             // Both start the release of every note on the channel
+    case NOTESOFF: PROC_YM3812.instAllOff( channel-1 );                 break;
+    case MAXVOICES: PROC_YM3812.instSetMaxVoices( channel-1, val );     break; // Most notes the instrument plays at once
+    case RESERVE:  PROC_YM3812.instSetReservedVoices( channel-1, val ); break; // Channels other instruments can't steal
+    case VOLUME:   PROC_YM3812.instSetVolume(   channel-1, val );       break; // Rewrites the carrier levels of notes already playing
+    case EXPRESSION: PROC_YM3812.instSetExpression( channel-1, val );   break;
+    case LFOWAVE:  PROC_YM3812.instSetLfoWave(  channel-1, val >> 5 );  break; // Split the CC range into one zone per waveform
+    case LFORATE:  PROC_YM3812.instSetLfoRate(  channel-1, val );       break; // LFO speed
+    case LFODEPTH: PROC_YM3812.instSetLfoDepth( channel-1, val );       break; // LFO depth at full mod wheel
+    case LFODELAY: PROC_YM3812.instSetLfoDelay( channel-1, val );       break; // LFO fade in time
+  }
+}
+
+
+
+/*******************************************
+ * Statistics                              *
+ *******************************************/
+// How hard the module is working, for checking whether it is running out of voices or bus time. Most of the
+// numbers are kept by the YM3812 class (YM_Stats); the MIDI side is counted here. Every counter is a plain
+// running total, and the per second rates are worked out from them once a second in statsService. The values
+// go out as a SysEx Stats message (see SysEx Patch Transfer), on request or every few seconds.
+
+#define  STATS_VALUES      12                                                  // Values in a Stats message (see statsSnapshot)
+
+uint32_t midi_messages = 0;                                                    // MIDI messages read
+uint8_t  rx_peak       = 0;                                                    // Most bytes found waiting in the receive buffer
+uint16_t rx_overruns   = 0;                                                    // Times the receive buffer was found full (bytes were probably lost)
+uint32_t bus_rate      = 0;                                                    // Register writes in the last second
+uint32_t midi_rate     = 0;                                                    // MIDI messages in the last second
+uint8_t  stats_interval = 0;                                                   // Seconds between Stats messages (0 = only on request)
+bool     stats_request = false;                                                // A Stats message is due
+uint32_t stats_snap[ STATS_VALUES ];                                           // Values of the Stats message being sent
+
+void statsCheckRx(){                                                           // See how full the receive buffer got (call before reading it)
+  uint8_t waiting = Serial2.available();
+  if( waiting > rx_peak ) rx_peak = waiting;
+  if( waiting >= SERIAL_RX_BUFFER_SIZE - 1 ) rx_overruns++;
+}
+
+void statsService(){                                                           // Work out the rates (call from loop)
+  static unsigned long last_second = 0;
+  static uint32_t last_writes = 0, last_messages = 0;
+  static uint8_t  seconds = 0;
+  if( millis() - last_second < 1000 ) return;
+  last_second = millis();
+
+  bus_rate      = PROC_YM3812.getBusWrites() - last_writes;
+  midi_rate     = midi_messages - last_messages;
+  last_writes   = PROC_YM3812.getBusWrites();
+  last_messages = midi_messages;
+  if( stats_interval && ++seconds >= stats_interval ){                         // Time for the next streamed message
+    seconds = 0;
+    stats_request = true;
   }
 }
 
+void ledTask(){                                                                // Bus load on the data LED, blinking when MIDI input or the tick fell behind
+  static uint16_t rx_seen   = 0;
+  static uint32_t tick_seen = 0;
+  if( rx_overruns != rx_seen || CONTROL.getOverruns() != tick_seen ){          // Something got lost since the last tick
+    rx_seen   = rx_overruns;
+    tick_seen = CONTROL.getOverruns();
+    PROC_YM3812.ledAlarm();
+  }
+  PROC_YM3812.ledUpdate();
+}
+
+void statsSnapshot(){                                                          // Freeze the values for a Stats message
+  const YM_Stats &stats = PROC_YM3812.getStats();
+  stats_snap[0]  = PROC_YM3812.getActiveVoices();
+  stats_snap[1]  = stats.voices_peak;
+  stats_snap[2]  = stats.steals[YM_STEAL_LIMIT];
+  stats_snap[3]  = stats.steals[YM_STEAL_OVER];
+  stats_snap[4]  = stats.steals[YM_STEAL_OLDEST];
+  stats_snap[5]  = stats.patch_loads;
+  stats_snap[6]  = bus_rate;
+  stats_snap[7]  = stats.skipped_writes;
+  stats_snap[8]  = midi_rate;
+  stats_snap[9]  = rx_peak;
+  stats_snap[10] = rx_overruns;
+  stats_snap[11] = CONTROL.getOverruns();
+}
+
+
+
+/*******************************************
+ * SysEx Patch Transfer                    *
+ *******************************************/
+// Patches can be sent to the module (and read back out of it) as SysEx messages, using the non-commercial
+// manufacturer ID. Every patch value is already 7 bits, so the data needs no encoding:
+//
+//   Patch:         F0 7D 01 <inst> <PATCH_SIZE bytes> <checksum> F7     Loads a patch into an instrument (0-15)
+//   Patch request: F0 7D 02 <inst> F7                                   Replies with a Patch message for the instrument
+//   Bank request:  F0 7D 03 F7                                          Replies with a Patch message for every instrument
+//   Store:         F0 7D 04 <inst> <program> F7                         Saves the instrument's patch to the user bank
+//   Profile:       F0 7D 05 F7                                          Prints the profiler table on Serial (PROFILE builds)
+//   Stats request: F0 7D 06 F7                                          Replies with a Stats message
+//   Stats stream:  F0 7D 07 <seconds> F7                                Sends a Stats message every 1-15 seconds (0 = stop)
+//   Stats:         F0 7D 06 <STATS_VALUES values> F7                    Each value is 5 bytes of 7 bits, lowest first:
+//                    0 active voices     1 voice peak          2 steals (voice limit)   3 steals (over reservation)
+//                    4 steals (oldest)   5 patch loads         6 bus writes per second  7 skipped writes
+//                    8 MIDI messages/s   9 receive buffer peak 10 receive overruns      11 control tick overruns
+//
+// The checksum makes the 7-bit sum of the data and checksum zero. A bank is just the Patch messages of all the
+// instruments, so sending a bank dump back restores it.
+//
+// Uploads are decoded a byte at a time as they arrive (sysexByte), straight into a free slot of the patch pool,
+// so there is never a buffer holding the whole message. The slot only gets handed to the instrument once the
+// checksum checks out at the end of the message; anything wrong and the slot just stays free. Notes that are
+// already playing keep their old patch, and the next note uses the new one.
+//
+// Dumps are sent by sysexSend in loop(), a few bytes at a time, only as many as fit in the serial transmit
+// buffer. A bank dump takes a while at MIDI speed, but nothing waits for it.
+//
+// A Store replaces program <program> with the instrument's current patch from then on, including after power
+// cycles. The flash write itself happens later (see User Patch Bank).
+//
+// Stats messages go out the same way as dumps, and the two take turns so their bytes never get mixed up.
+
+#define  SYSEX_ID          0x7D                                                // Non-commercial manufacturer ID
+#define  SYSEX_PATCH       0x01                                                // Patch data
+#define  SYSEX_PATCH_REQ   0x02                                                // Patch dump request
+#define  SYSEX_BANK_REQ    0x03                                                // Bank dump request
+#define  SYSEX_STORE       0x04                                                // Store a patch in the user bank
+#define  SYSEX_PROFILE     0x05                                                // Profiler report request
+#define  SYSEX_STATS       0x06                                                // Stats request (and the reply)
+#define  SYSEX_STATS_STREAM 0x07                                               // Stats streaming interval
+#define  SYSEX_STATS_LEN   (3 + STATS_VALUES * 5 + 1)                          // Length of a Stats message (F0 to F7)
+#define  SYSEX_HEADER      3                                                   // Bytes before the patch data (after F0): ID, command, instrument
+#define  SYSEX_PATCH_LEN   (SYSEX_HEADER + PATCH_SIZE + 1)                     // Length of a Patch message (after F0, before F7)
+
+uint8_t  sysex_pos  = 0;                                                       // Bytes received since F0
+uint8_t  sysex_cmd  = 0;                                                       // Command being received
+uint8_t  sysex_inst = 0;                                                       // Instrument the message is for
+uint8_t  sysex_sum  = 0;                                                       // Running checksum
+uint8_t  sysex_prog = 0;                                                       // Program number of a Store
+bool     profile_dump = false;                                                 // Profiler report was requested (printed from loop)
+bool     sysex_ok   = false;                                                   // Message is still worth listening to
+
+uint8_t  dump_inst  = 0;                                                       // Instrument being dumped
+uint8_t  dump_last  = 0;                                                       // Last instrument to dump
+uint8_t  dump_pos   = 0xFF;                                                    // Next byte of the Patch message to send (0xFF = not dumping)
+uint8_t  dump_sum   = 0;                                                       // Running checksum of the dump
+uint8_t  stats_pos  = 0xFF;                                                    // Next byte of the Stats message to send (0xFF = not sending)
+
+void sysexStart(){                                                             // F0 arrived
+  sysex_pos = sysex_sum = 0;
+  sysex_ok  = true;
+  pool_reserved = NULL;
+}
+
+void sysexByte( byte data ){                                                   // Handle one byte of a SysEx message (between F0 and F7)
+  if( !sysex_ok ) return;
+  uint8_t pos = sysex_pos++;
+
+  if( pos == 0 ) sysex_ok = (data == SYSEX_ID);                                // Not for us
+  else if( pos == 1 ) sysex_cmd = data;
+  else if( pos == 2 ){
+    sysex_inst = data;
+    sysex_ok   = (data < MAX_INSTRUMENTS);
+    if( sysex_ok && sysex_cmd == SYSEX_PATCH ){
+      pool_reserved = poolSlot();                                              // Somewhere to put the patch
+      sysex_ok = (pool_reserved != NULL);
+    }
+  }
+  else if( sysex_cmd == SYSEX_STORE && pos == SYSEX_HEADER ) sysex_prog = data; // Program number to store to
+  else if( sysex_cmd != SYSEX_PATCH || pos >= SYSEX_PATCH_LEN ) sysex_ok = false; // Too long
+  else {
+    sysex_sum += data;
+    if( pos < SYSEX_HEADER + PATCH_SIZE ) pool_reserved[ pos - SYSEX_HEADER ] = data; // Straight into the slot
+  }
+}
+
+void sysexDump( byte first, byte last ){                                       // Start sending Patch messages for a range of instruments
+  dump_inst = first;
+  dump_last = last;
+  dump_pos  = 0;
+}
+
+void statsSend(){                                                              // Send as much of a Stats message as fits in the transmit buffer
+  if( stats_pos == 0xFF && stats_request && dump_pos == 0xFF ){                // Start one once any dump is out of the way
+    stats_request = false;
+    statsSnapshot();
+    stats_pos = 0;
+  }
+  while( stats_pos != 0xFF && Serial2.availableForWrite() > 0 ){
+    uint8_t pos = stats_pos++;
+    uint8_t data;
+    if( pos == 0 ) data = 0xF0;
+    else if( pos == 1 ) data = SYSEX_ID;
+    else if( pos == 2 ) data = SYSEX_STATS;
+    else if( pos < SYSEX_STATS_LEN - 1 ){
+      pos -= 3;
+      data = (stats_snap[ pos / 5 ] >> ( 7 * (pos % 5) )) & 0x7F;              // 7 bits at a time, 5 of them hold all 32
+    }
+    else {
+      data = 0xF7;
+      stats_pos = 0xFF;                                                        // Done
+    }
+    Serial2.write( data );
+  }
+}
+
+void sysexSend(){                                                              // Send as much of a dump as fits in the transmit buffer
+  statsSend();
+  while( dump_pos != 0xFF && stats_pos == 0xFF && Serial2.availableForWrite() > 0 ){
+    uint8_t pos = dump_pos++;
+    uint8_t data;
+
+    if( pos == 0 ){ data = 0xF0; dump_sum = 0; }
+    else if( pos == 1 ) data = SYSEX_ID;
+    else if( pos == 2 ) data = SYSEX_PATCH;
+    else if( pos == 3 ) data = dump_inst;
+    else if( pos <= SYSEX_HEADER + PATCH_SIZE ){
+      data = inst_patch[dump_inst][ pos - SYSEX_HEADER - 1 ] & 0x7F;           // Reads flash, packed or RAM patches alike
+      dump_sum += data;
+    }
+    else if( pos == SYSEX_PATCH_LEN ) data = (0x80 - (dump_sum & 0x7F)) & 0x7F; // Checksum
+    else {
+      data = 0xF7;
+      dump_pos = (dump_inst < dump_last) ? 0 : 0xFF;                           // On to the next instrument, or done
+      dump_inst++;
+    }
+    Serial2.write( data );
+  }
+}
+
+void sysexEnd(){                                                               // F7 arrived (or the message was cut short)
+  if( sysex_ok ){
+    switch( sysex_cmd ){
+      case SYSEX_PATCH:                                                        // Upload complete and the checksum adds up?
+        if( sysex_pos == SYSEX_PATCH_LEN && (sysex_sum & 0x7F) == 0 ){
+          inst_patch[sysex_inst] = YM_Patch( (PatchArr &)*pool_reserved );     // Instrument uses it from the next note
+        }
+        break;
+      case SYSEX_PATCH_REQ:
+        if( sysex_pos == SYSEX_HEADER ) sysexDump( sysex_inst, sysex_inst );
+        break;
+      case SYSEX_BANK_REQ:
+        if( sysex_pos == SYSEX_HEADER - 1 ) sysexDump( 0, MAX_INSTRUMENTS - 1 );
+        break;
+      case SYSEX_STORE:
+        if( sysex_pos == SYSEX_HEADER + 1 ) userBankStore( sysex_prog, sysex_inst );
+        break;
+      case SYSEX_PROFILE:
+        if( sysex_pos == SYSEX_HEADER - 1 ) profile_dump = true;
+        break;
+      case SYSEX_STATS:
+        if( sysex_pos == SYSEX_HEADER - 1 ) stats_request = true;
+        break;
+      case SYSEX_STATS_STREAM:
+        if( sysex_pos == SYSEX_HEADER ) stats_interval = sysex_inst;           // (checked to be 0-15 like an instrument)
+        break;
+    }
+  }
+  sysex_ok = false;
+  pool_reserved = NULL;                                                        // Slot is either in use now, or free again
+}
+
+#if !MIDI_PARSER
+  void handleSysEx( byte *data, unsigned size ){                               // The MIDI library hands over the whole message (F0 ... F7)
+    sysexStart();
+    for( unsigned i = 1; i + 1 < size; i++ ) sysexByte( data[i] );
+    sysexEnd();
+  }
+#endif
+
+#if MIDI_PARSER || SMF_PLAYER
+  void handleMidiEvent( const MidiEvent &event ){                              // Hand a message from MidiParser (or SmfPlayer) to its handler
+    switch( event.type ){
+      case MIDI_NOTE_ON:    handleNoteOn(        event.channel, event.data1, event.data2 ); break;
+      case MIDI_NOTE_OFF:   handleNoteOff(       event.channel, event.data1, event.data2 ); break;
+      case MIDI_CONTROL:    handleControlChange( event.channel, event.data1, event.data2 ); break;
+      case MIDI_PROGRAM:    handleProgramChange( event.channel, event.data1 );              break;
+      case MIDI_PITCH_BEND: handlePitchBend(     event.channel, event.bend() );             break;
+      #if MIDI_PARSER
+      case MIDI_SYSEX:                                                         // SysEx arrives in chunks
+        if( event.data2 & MIDI_SYSEX_START ) sysexStart();
+        for( uint8_t i = 0; i < event.data1; i++ ) sysexByte( MIDI_IN.sysexData()[i] );
+        if( event.data2 & MIDI_SYSEX_END ) sysexEnd();
+        break;
+      #endif
+    }
+  }
+#endif
+
+
+
+/*******************************************
+ * Song Player                             *
+ *******************************************/
+// With SMF_PLAYER on, the module plays demo_song (songs.h) over and over on its own, for demos and installations.
+// SmfPlayer streams the file out of flash and its events go through handleMidiEvent like live MIDI. Notes that
+// are about to start get their patch sent to a free channel ahead of time (preloadNote), so the key on isn't
+// held up by the patch upload.
+
+#if SMF_PLAYER
+  SmfPlayer SONG;                                                              // Plays a MIDI file from flash
+
+  void preloadNote( byte channel, byte midiNote ){                             // Send the patch for a note that's about to play
+    if( DRUM_CHANNEL == channel ){
+      PROC_YM3812.patchPreload( drumPatch( drumNoteIndex( midiNote ) ) );
+    } else {
+      PROC_YM3812.patchPreload( inst_patch[channel - 1] );
+    }
+  }
+
+  void songService(){                                                          // Keep the song playing
+    MidiEvent event;
+    if( !SONG.playing() ) SONG.play();                                         // Round again
+    perf_hold = true;                                                          // The song's program changes aren't the player's setup
+    while( SONG.read( event ) ) handleMidiEvent( event );                      // Everything that is due
+    perf_hold = false;
+    if( SONG.lookahead( event ) ) preloadNote( event.channel, event.data1 );   // and get ready for what's next
+  }
+#endif
+
 
 
 /*******************************************
@@ -170,26 +714,57 @@ void handleControlChange( byte channel, byte command, byte val ){              /
 void setup(void) {
 
   // Initialize Patches
-  for( byte i=0; i<MAX_INSTRUMENTS; i++ ){                                     // Load patch data from channel_patches into the
+  for( byte i=0; i<MAX_INSTRUMENTS; i++ ){
     inst_patch_index[i] = i;                                                   // By default, use a different patch for each midi channel
-    loadPatchFromProgMem( i, inst_patch_index[i] );                            // instruments array (inst_patch_data)
     inst_pitch_bend[i] = 0x2000;                                               // Set pitch bend to middle value by default
   }
   for( byte i=0; i<NUM_DRUMS; i++ ){                                           // Loop through all of the drum patches and by default,
     drum_patch_index[i] = i;                                                   // Map each drum to another patch, wrap around if more notes than patches
-    loadDrumPatchFromProgMem( i, drum_patch_index[i] );                        // Load the drum patches into memory for each drum track
+  }
+  perfRestore();                                                               // Unless the setup was saved last time
+
+  USER_BANK.begin();                                                           // Find the stored user patches before loading any
+  for( byte i=0; i<MAX_INSTRUMENTS; i++ ){                                     // Load patch data from channel_patches into the
+    loadPatchFromProgMem( i, inst_patch_index[i] );                            // instrument handles (inst_patch)
   }
 
   PROC_YM3812.reset();
+  PROC_YM3812.setControlRate( CONTROL_RATE );                                  // Envelope times are counted in control ticks
+
+  //Control Tick Setup
+  CONTROL.addTask( clockTask, "clock" );                                       // Count the tick before anything uses it
+  CONTROL.addTask( applyPitchBends, "pitch bend" );                            // Apply latched pitch bends
+  CONTROL.addVoiceTask( pegTask, YM3812_NUM_CHANNELS, "pitch env" );           // Step the pitch envelopes
+  CONTROL.addVoiceTask( glideTask, YM3812_NUM_CHANNELS, "glide" );             // Step the portamento
+  CONTROL.addVoiceTask( lfoTask, YM3812_NUM_CHANNELS, "lfo" );                 // Apply the LFOs
+  CONTROL.addTask( ledTask, "led" );                                           // Drive the bus load meter
+  CONTROL.setBudget( CONTROL_BUDGET );
+  CONTROL.begin( CONTROL_RATE );                                               // Start the timer
+
+  #if CONTROL_REPORT || PROFILE
+    Serial.begin( 115200 );                                                    // Statistics go out of the first serial port
+  #endif
+  #if PROFILE
+    profileBegin();                                                            // Start the profiler's cycle counter
+  #endif
+
+  #if SMF_PLAYER
+    SONG.begin( demo_song, sizeof( demo_song ) );                              // Starts playing on the first loop
+  #endif
 
   //MIDI Setup
-  MIDI.setHandleNoteOn(  handleNoteOn );                                       // Setup Note-on Handler function
-  MIDI.setHandleNoteOff( handleNoteOff );                                      // Setup Note-off Handler function
-  MIDI.setHandleProgramChange( handleProgramChange );                          // Setup Program Change Handler function
-  MIDI.setHandlePitchBend( handlePitchBend );
-  MIDI.setHandleControlChange( handleControlChange );
-
-  MIDI.begin();                                                                // Start listening for incoming MIDI
+  #if MIDI_PARSER
+    MIDI_IN.begin( Serial2 );                                                  // Start listening for incoming MIDI
+  #else
+    MIDI.setHandleNoteOn(  handleNoteOn );                                     // Setup Note-on Handler function
+    MIDI.setHandleNoteOff( handleNoteOff );                                    // Setup Note-off Handler function
+    MIDI.setHandleProgramChange( handleProgramChange );                        // Setup Program Change Handler function
+    MIDI.setHandlePitchBend( handlePitchBend );
+    MIDI.setHandleControlChange( handleControlChange );
+    MIDI.setHandleSystemExclusive( handleSysEx );                              // Setup SysEx Handler function (patch transfer)
+
+    MIDI.begin();                                                              // Start listening for incoming MIDI
+  #endif
 
 }
 
@@ -203,6 +778,57 @@ void setup(void) {
 
 void loop() {                                                                  // Main Loop Function
 
-  while( MIDI.read(0) ){}                                                      // Read all incoming data on all MIDI Channels
+  statsCheckRx();                                                               // See how far behind the MIDI input got
+
+  #if MIDI_PARSER
+    MidiEvent event;
+    while( MIDI_IN.read( event ) ){                                            // Handle everything waiting in the receive buffer
+      handleMidiEvent( event );
+      midi_messages++;
+    }
+  #else
+    while( MIDI.read(0) ) midi_messages++;                                     // Read all incoming data on all MIDI Channels
+  #endif
+
+  #if SMF_PLAYER
+    songService();                                                             // Play the song
+  #endif
+
+  statsService();                                                              // Keep the statistics rates up to date
+  sysexSend();                                                                 // Keep any patch dump (or Stats message) moving
+  userBankService();                                                           // Write stored patches to flash when it's quiet
+  PERFORMANCE.service();                                                       // Save the performance setup a byte at a time
+
+  CONTROL.run();                                                               // Run the control tick tasks if a tick is due
+
+  #if PROFILE
+    if( profile_dump ){                                                        // Asked for over SysEx
+      profile_dump = false;
+      profileReport( Serial );
+      profileReset();                                                          // Each report covers the time since the last one
+    }
+  #endif
+
+  #if CONTROL_REPORT
+    static unsigned long last_report = 0;
+    if( millis() - last_report >= CONTROL_REPORT * 1000UL ){                   // Every so often...
+      last_report = millis();
+      CONTROL.report( Serial );                                                // Print the control tick statistics
+      Serial.print( "Steals:" );                                               // and how many notes each midi channel lost
+      for( uint8_t i = 0; i < MAX_INSTRUMENTS; i++ ){
+        Serial.print( ' ' ); Serial.print( PROC_YM3812.instGetSteals( i ) );
+      }
+      Serial.println();
+      #if SMF_PLAYER
+        SONG.report( Serial );                                                 // and how well the song is keeping time
+      #endif
+      Serial.print( "Bus writes: " );                                          // and how busy the chip has been
+      Serial.println( PROC_YM3812.getBusWrites() );
+      Serial.print( "User bank writes: " );                                    // and how hard the user bank is working the flash
+      Serial.println( USER_BANK.getWrites() );
+      Serial.print( "User bank lost: " );                                      // and how many pages of changes never made it
+      Serial.println( USER_BANK.getLost() );
+    }
+  #endif
 
 }
@@ -77,6 +77,35 @@ val = GET_BITS( regVal, 0b01110000, 4 );
 
 typedef uint8_t PatchArr[PATCH_SIZE]; // Define the PatchArr type as a uint8_t array
 
+// A YM_Patch is a lightweight handle that refers to patch data without owning a copy of it. The data lives in one
+// of three places: a generic patch array in flash (PROGMEM), a RAM PatchArr when a patch has been edited, or an
+// entry in a packed bank in flash, which is where the factory patches sit. Reading through the handle with []
+// works the same for all of them, so the rest of the code doesn't care.
+
+#define PATCH_TYPE_FLASH       0 // Generic patch array stored in PROGMEM
+#define PATCH_TYPE_RAM         1 // Generic patch array held in RAM
+#define PATCH_TYPE_PACKED      2 // Packed bank entry stored in PROGMEM (see Packed Patch Format below)
+
+uint8_t unpackPatchField( const uint8_t *packed, uint8_t field );                                 // Decode a single generic value from a packed patch
+
+struct YM_Patch{
+  const uint8_t *data   = NULL;                                                                   // Where the patch data lives
+  uint8_t        type   = PATCH_TYPE_FLASH;                                                       // How the data is stored (PATCH_TYPE_*)
+
+  YM_Patch(){}                                                                                    // Empty handle (no patch)
+  YM_Patch( PatchArr &ramPatch ) : data( ramPatch ), type( PATCH_TYPE_RAM ) {}                    // Handle to a patch held in RAM
+  explicit YM_Patch( const uint8_t *flashPatch ) : data( flashPatch ), type( PATCH_TYPE_FLASH ) {} // Handle to a patch stored in PROGMEM
+  YM_Patch( const uint8_t *src, uint8_t srcType ) : data( src ), type( srcType ) {}               // Handle to patch data of any type
+
+  uint8_t operator[]( uint8_t i ) const {                                                         // Read a patch value, wherever it happens to live
+    if( type == PATCH_TYPE_RAM )   return( data[i] );
+    if( type == PATCH_TYPE_FLASH ) return( pgm_read_byte( data + i ) );
+    return( unpackPatchField( data, i ) );
+  }
+  bool operator==( const YM_Patch &p ) const { return( data == p.data ); }                        // Two handles match if they point at the same data
+  bool operator!=( const YM_Patch &p ) const { return( data != p.data ); }
+};
+
 // Instrument Level / Virtual
 #define PATCH_PROC_CONF        0 // Specifies the processor and desired processor configuration
 #define PATCH_NOTE_NUMBER      1 // Indicates the pitch to use when playing as a drum sound
@@ -84,6 +113,8 @@ typedef uint8_t PatchArr[PATCH_SIZE]; // Define the PatchArr type as a uint8_t a
 #define PATCH_PEG_ATTACK       3 // Pitch Envelope Attack (Virtual setting - none of the YM chips have this by default)
 #define PATCH_PEG_RELEASE      4 // Pitch Envelope Release (Virtual setting - none of the YM chips have this by default)
 #define PATCH_PEG_REL_LEVEL    5 // Final Release Level (Virtual setting - none of the YM chips have this by default)
+// The pitch envelope levels are 7-bit signed values in quarter semitones (0x01 = +1/4, 0x7F = -1/4, 0x40 = -16 semitones)
+// so that a patch with all zeros has no pitch envelope. Attack and release are times, 0 = instant, up to ~4s at 127.
 
 // Channel Level
 #define PATCH_FEEDBACK         6 // Used by: YM3526 | YM3812 | YMF262 | YM2413 | YM2151 |        | YM2612 |
@@ -111,6 +142,39 @@ typedef uint8_t PatchArr[PATCH_SIZE]; // Define the PatchArr type as a uint8_t a
 #define PATCH_SSGENV_WAVEFORM 26 // Used by:        |        |        |        |        |        | YM2612 | *SN76489
 
 
+//---------------- PACKED PATCH FORMAT ----------------//
+// A generic patch takes 78 bytes, but a 2OP voice only needs 11 register bytes on the OPL family of chips. The
+// packed format stores just those register values (already composed, so they can be copied straight to the chip)
+// plus a flag byte saying which of the optional blocks follow. Patches in a packed bank are different lengths, so
+// the bank comes with an index of offsets that lets us jump straight to any patch. The instrument converter
+// (Articles 7/InstrumentConverter/op2.js) generates both the bank and the index.
+//
+//   Byte 0      Flags (PACKED_FLAG_*)
+//   Byte 1      PATCH_PROC_CONF
+//   Byte 2      PATCH_NOTE_NUMBER
+//   Bytes 3-13  Voice 1: 0xC0, then 0x20, 0x40, 0x60, 0x80, 0xE0 for operator 1 followed by operator 2
+//   +12 bytes   Voice 2 (if PACKED_FLAG_VOICE2): same 11 register bytes, then PATCH_DETUNE_FINE of operator 3
+//   +6 bytes    Virtual (if PACKED_FLAG_VIRTUAL): PEG init, attack, release, release level, tremolo & vibrato sens
+
+#define PACKED_FLAGS           0 // Offset of the flag byte
+#define PACKED_PROC_CONF       1 // Offset of the processor / configuration byte
+#define PACKED_NOTE_NUMBER     2 // Offset of the drum note number
+#define PACKED_VOICE           3 // Offset of the first voice's register image
+#define PACKED_VOICE_SIZE     11 // Bytes in a voice's register image (0xC0 + 5 registers for each of 2 operators)
+#define PACKED_OP_SIZE         5 // Bytes for each operator within a voice's register image
+#define PACKED_VIRTUAL_SIZE    6 // Bytes in the virtual settings block
+
+#define PACKED_REG_C0          0 // Voice image offset of the feedback / algorithm register
+#define PACKED_REG_20          0 // Operator offsets of each register (from the start of the operator's block)
+#define PACKED_REG_40          1
+#define PACKED_REG_60          2
+#define PACKED_REG_80          3
+#define PACKED_REG_E0          4
+
+#define PACKED_FLAG_VOICE2     0b01 // A second voice (and its detune) follows the first
+#define PACKED_FLAG_VIRTUAL    0b10 // The virtual settings block is present (otherwise all zero)
+
+
 // Processor IDs
 // Processor type field is composed of two nibbles. The upper nibble indicates the desired processor
 // type, or can be zero so the system can choose any available processor capable of rendering the correct configuration.
@@ -132,6 +196,38 @@ typedef uint8_t PatchArr[PATCH_SIZE]; // Define the PatchArr type as a uint8_t a
 #define CONF_4OP           0b0100 // 4 operoator voice
 
 
+// Velocity Curves
+// Selects how note velocity is translated into operator level. Each curve is a 128 entry table
+// that reshapes the incoming velocity before it is applied to the operator levels.
+
+#define VEL_CURVE_LINEAR      0  // Velocity maps straight through (default)
+#define VEL_CURVE_EXPONENTIAL 1  // Softer response, more of the range spent on loud notes
+#define VEL_CURVE_LOGARITHMIC 2  // Louder response, quiet notes come up quickly
+#define VEL_CURVE_FIXED       3  // Ignore velocity, every note plays at full level
+#define VEL_CURVES            4  // Total number of velocity curves
+
+
+// LFO Waveforms
+// Shapes available to the software LFO of each instrument. Each one is a 64 step table in YM3812.cpp.
+
+#define LFO_SINE              0  // Smooth vibrato / tremolo (default)
+#define LFO_TRIANGLE          1  // Straight ramps up and down
+#define LFO_SQUARE            2  // Jumps between the two extremes (trills)
+#define LFO_SAW               3  // Ramps down, then jumps back up
+#define LFO_WAVES             4  // Total number of LFO waveforms
+
+
+// Mono Mode
+// A mono instrument plays one note at a time on a single channel. It remembers the notes being held so that
+// releasing one goes back to another, and the priority decides which of the held notes is heard.
+
+#define MONO_STACK_SIZE       8  // Number of held notes remembered by a mono instrument
+#define MONO_LAST             0  // The newest held note plays (default)
+#define MONO_LOW              1  // The lowest held note plays
+#define MONO_HIGH             2  // The highest held note plays
+#define MONO_PRIORITIES       3  // Total number of note priorities
+
+
 // PITCH BEND MIDI CONSTANT
 
 #define PITCH_WHEEL_RANGE 0x3FFF
@@ -142,15 +238,72 @@ typedef uint8_t PatchArr[PATCH_SIZE]; // Define the PatchArr type as a uint8_t a
 // the best channel to use when playing a new note.
 
 struct YM_Channel{
-  PatchArr      *pPatch    = NULL;                                                                // Pointer to the patch playing on the channel
+  YM_Patch      patch;                                                                            // Handle to the patch playing on the channel
   uint8_t       midi_note  = 0;                                                                   // The pitch of the note associated with the channel
   uint8_t       velocity   = 127;                                                                 // The velocity of the note
   bool          note_state = false;                                                               // Whether the note is on (true) or off (false)
   unsigned long state_changed;                                                                    // The time that the note state changed (millis)
 
-  int8_t   bend_note;                                                                              // Pitch Bend note offset
-  uint16_t bend_rem;                                                                               // Pitch Bend sub-note offset
+  int16_t       bend       = 0;                                                                   // Pitch Bend offset in 1/256ths of a semitone (8.8 fixed point)
+  uint8_t       inst       = 0xFF;                                                                // Instrument (midi channel) that the note belongs to (0xFF = none yet)
+
+  uint8_t       voice      = 0;                                                                   // Voice of the patch being played (1 = second voice of a 2x2OP patch)
+  uint8_t       link       = 0xFF;                                                                // Channel playing the other voice of a 2x2OP patch (0xFF = none)
+  int8_t        detune     = 0;                                                                   // Fine tune offset of the voice in 1/32nds of a semitone
+
+  int16_t       peg        = 0;                                                                   // Current pitch envelope offset (8.8 fixed point semitones)
+  int16_t       peg_target = 0;                                                                   // Offset the pitch envelope is heading to
+  int16_t       peg_step   = 0;                                                                   // Change in offset per control tick (0 = envelope is idle)
+  uint8_t       peg_tick   = 0;                                                                   // Control tick the envelope was last updated on
+
+  uint8_t       level[2]   = {63, 63};                                                            // Operator levels after velocity (before any modulation)
+  uint8_t       carriers   = 0b10;                                                                // Which operators are carriers (bit 0 = op 1, bit 1 = op 2)
+  uint8_t       lfo_vsens  = 0;                                                                   // Vibrato sensitivity of the patch
+  uint8_t       lfo_tsens  = 0;                                                                   // Tremolo sensitivity of the patch
+  uint16_t      lfo_fade   = 0;                                                                   // LFO fade in since note on (0 - 0xFFFF = full depth)
+  uint16_t      lfo_step   = 0xFFFF;                                                              // Fade in per control tick
+  int16_t       lfo_vib    = 0;                                                                   // Current vibrato offset (8.8 fixed point semitones)
+  uint8_t       lfo_trem   = 0;                                                                   // Current tremolo attenuation (level steps)
+
+  int16_t       glide      = 0;                                                                   // Portamento offset from midi_note (8.8 fixed point semitones)
+  int16_t       glide_step = 0;                                                                   // Change in glide per control tick (0 = not gliding)
+  uint8_t       glide_tick = 0;                                                                   // Control tick the glide was last updated on
+
+  bool          preloaded  = false;                                                               // Patch was sent ahead of its note (see patchPreload)
+
+};
 
+// The YM_Instrument structure holds the settings that belong to a midi channel rather than to a
+// patch or to a single note. Every note played on the channel picks these up.
+
+struct YM_Instrument{
+  uint8_t       vel_curve  = VEL_CURVE_LINEAR;                                                    // Velocity curve used to scale operator levels
+
+  uint8_t       volume     = 127;                                                                 // Channel volume (CC7)
+  uint8_t       expression = 127;                                                                 // Expression (CC11)
+  uint8_t       atten      = 0;                                                                   // Attenuation (level steps) from volume and expression
+
+  uint8_t       voices     = 0;                                                                   // Channels currently playing a note for the instrument
+  uint8_t       max_voices = 0xFF;                                                                // Most channels the instrument can play at once (0xFF = no limit)
+  uint8_t       reserved   = 0;                                                                   // Channels kept free for the instrument when other instruments need one
+  uint16_t      steals     = 0;                                                                   // Number of the instrument's notes cut off to make room for another
+
+  uint8_t       mono       = false;                                                               // Mono mode on / off
+  uint8_t       mono_priority = MONO_LAST;                                                        // Which held note plays in mono mode (MONO_*)
+  uint8_t       mono_ch    = 0xFF;                                                                // Channel used by the mono voice
+  uint8_t       num_held   = 0;                                                                   // Number of notes in the held note stack
+  uint8_t       held[MONO_STACK_SIZE];                                                            // Held note stack (oldest first)
+
+  uint8_t       glide_on   = false;                                                               // Portamento on / off (CC65)
+  uint8_t       glide_time = 0;                                                                   // Portamento time (CC5)
+
+  uint8_t       mod_wheel  = 0;                                                                   // Modulation wheel position, scales the LFO depth
+  uint8_t       lfo_rate   = 65;                                                                  // LFO speed (0 - 127, default is about 5.5Hz)
+  uint8_t       lfo_depth  = 127;                                                                 // LFO depth with the mod wheel all the way up
+  uint8_t       lfo_delay  = 0;                                                                   // Time for the LFO to fade in after note on
+  uint8_t       lfo_wave   = LFO_SINE;                                                            // LFO waveform (LFO_*)
+  uint16_t      lfo_inc    = 0;                                                                   // LFO phase change per control tick (from lfo_rate)
+  uint16_t      lfo_phase  = 0;                                                                   // Current LFO phase
 };
 
 
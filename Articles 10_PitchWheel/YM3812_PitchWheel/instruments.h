@@ -1,180 +1,358 @@
 #ifndef INSTRUMENTS_H
 #define INSTRUMENTS_H
-const unsigned char ym_patch_0[78] PROGMEM = {0x22,0x00,0x00,0x00,0x00,0x00,0x50,0x00,0x00,0x00,0x20,0x1E,0x60,0x00,0x40,0x78,0x00,0x78,0x00,0x20,0x00,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x78,0x20,0x10,0x00,0x30,0x00,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}; // Acoustic Grand Piano
-const unsigned char ym_patch_1[78] PROGMEM = {0x22,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x0E,0x60,0x00,0x40,0x78,0x00,0x78,0x00,0x20,0x00,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x78,0x20,0x10,0x00,0x30,0x00,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}; // Bright Acoustic Piano
-const unsigned char ym_patch_2[78] PROGMEM = {0x22,0x00,0x00,0x00,0x00,0x00,0x50,0x00,0x00,0x00,0x00,0x36,0x00,0x00,0x40,0x78,0x00,0x78,0x00,0x20,0x00,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x78,0x20,0x10,0x00,0x30,0x00,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}; // Electric Grand Piano
-const unsigned char ym_patch_3[78] PROGMEM = {0x22,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x1C,0x60,0x00,0x40,0x78,0x00,0x78,0x00,0x20,0x40,0x00,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x78,0x20,0x10,0x00,0x30,0x40,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}; // Honky-tonk Piano
-const unsigned char ym_patch_4[78] PROGMEM = {0x22,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0x00,0x00,0x00,0x24,0x00,0x00,0x00,0x78,0x18,0x48,0x00,0x28,0x00,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0x78,0x08,0x40,0x00,0x68,0x00,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}; // Electric Piano 1
-const unsigned char ym_patch_5[78] PROGMEM = {0x22,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x50,0x60,0x00,0x40,0x78,0x28,0x50,0x00,0x20,0x00,0x40,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x78,0x18,0x20,0x00,0x38,0x00,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}; // Electric Piano 2
-const unsigned char ym_patch_6[78] PROGMEM = {0x22,0x00,0x00,0x00,0x00,0x00,0x50,0x00,0x00,0x00,0x20,0x0C,0x60,0x00,0x00,0x78,0x08,0x58,0x00,0x78,0x00,0x00,0x08,0x00,0x00,0x00,0x00,0x60,0x0C,0x00,0x40,0x00,0x78,0x18,0x10,0x00,0x30,0x00,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}; // Harpsichord
-const unsigned char ym_patch_7[78] PROGMEM = {0x22,0x00,0x00,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x00,0x30,0x20,0x00,0x00,0x78,0x18,0x28,0x00,0x68,0x00,0x00,0x18,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x40,0x18,0x50,0x00,0x70,0x00,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}; // Clavi
-const unsigned char ym_patch_8[78] PROGMEM = {0x22,0x00,0x00,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x00,0x28,0x60,0x00,0x40,0x20,0x60,0x70,0x00,0x78,0x00,0x00,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x78,0x30,0x58,0x00,0x28,0x00,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}; // Celesta
-const unsigned char ym_patch_9[78] PROGMEM = {0x22,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x24,0x40,0x00,0x00,0x78,0x10,0x68,0x00,0x18,0x00,0x00,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0x78,0x20,0x40,0x00,0x18,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}; // Glockenspiel
-const unsigned char ym_patch_10[78] PROGMEM = {0x22,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x48,0x20,0x40,0x00,0x30,0x10,0x68,0x00,0x78,0x00,0x00,0x30,0x00,0x00,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x78,0x20,0x48,0x00,0x50,0x00,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}; // Music Box
-const unsigned char ym_patch_11[78] PROGMEM = {0x22,0x00,0x00,0x00,0x00,0x00,0x10,0x40,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x78,0x28,0x60,0x00,0x30,0x00,0x00,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x78,0x68,0x68,0x00,0x28,0x00,0x40,0x08,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}; // Vibraphone
-const unsigned char ym_patch_12[78] PROGMEM = {0x22,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x2A,0x60,0x00,0x00,0x30,0x68,0x70,0x00,0x38,0x00,0x00,0x50,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x78,0x00,0x78,0x00,0x28,0x00,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}; // Marimba
-const unsigned char ym_patch_13[78] PROGMEM = {0x22,0x00,0x00,0x00,0x00,0x00,0x60,0x00,0x00,0x00,0x40,0x10,0x60,0x40,0x00,0x78,0x40,0x48,0x00,0x28,0x00,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x78,0x30,0x10,0x00,0x38,0x00,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}; // Xylophone
-const unsigned char ym_patch_14[78] PROGMEM = {0x22,0x00,0x00,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x78,0x78,0x30,0x00,0x10,0x40,0x00,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0x78,0x00,0x78,0x00,0x18,0x00,0x00,0x28,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}; // Tubular Bells
-const unsigned char ym_patch_15[78] PROGMEM = {0x22,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x60,0x00,0x00,0x40,0x58,0x60,0x00,0x40,0x00,0x00,0x18,0x00,0x00,0x00,0x00,0x40,0x00,0x00,0x00,0x00,0x40,0x18,0x60,0x00,0x48,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}; // Dulcimer
-const unsigned char ym_patch_16[78] PROGMEM = {0x22,0x00,0x00,0x00,0x00,0x00,0x60,0x40,0x00,0x00,0x00,0x00,0x60,0x00,0x40,0x78,0x00,0x78,0x00,0x78,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0C,0x00,0x00,0x40,0x78,0x00,0x78,0x00,0x78,0x40,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}; // Hammond Organ
-const unsigned char ym_patch_17[78] PROGMEM = {0x22,0x00,0x00,0x00,0x00,0x00,0x70,0x40,0x00,0x00,0x40,0x00,0x00,0x00,0x40,0x78,0x78,0x30,0x00,0x78,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x40,0x78,0x00,0x78,0x00,0x78,0x00,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}; // Percussive Organ
-const unsigned char ym_patch_18[78] PROGMEM = {0x22,0x00,0x00,0x00,0x00,0x00,0x30,0x40,0x00,0x00,0x20,0x00,0x00,0x40,0x40,0x78,0x78,0x70,0x00,0x78,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x40,0x40,0x28,0x70,0x58,0x00,0x60,0x00,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}; // Rock Organ
-const unsigned char ym_patch_19[78] PROGMEM = {0x22,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0x00,0x20,0x24,0x00,0x00,0x40,0x78,0x00,0x78,0x00,0x58,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x40,0x00,0x00,0x40,0x40,0x28,0x00,0x78,0x00,0x58,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}; // Church Organ
-const unsigned char ym_patch_20[78] PROGMEM = {0x22,0x00,0x00,0x00,0x00,0x00,0x70,0x40,0x00,0x00,0x20,0x12,0x20,0x00,0x40,0x78,0x00,0x78,0x00,0x58,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x40,0x00,0x00,0x40,0x40,0x28,0x00,0x78,0x00,0x58,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}; // Reed Organ
-const unsigned char ym_patch_21[78] PROGMEM = {0x22,0x00,0x00,0x00,0x00,0x00,0x50,0x00,0x00,0x00,0x00,0x18,0x60,0x00,0x40,0x78,0x00,0x78,0x00,0x58,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x20,0x14,0x00,0x40,0x40,0x28,0x00,0x78,0x00,0x58,0x00,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}; // Accordion
-const unsigned char ym_patch_22[78] PROGMEM = {0x22,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x14,0x60,0x00,0x40,0x30,0x78,0x68,0x00,0x78,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x40,0x14,0x00,0x40,0x40,0x20,0x00,0x78,0x00,0x68,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}; // Harmonica
-const unsigned char ym_patch_23[78] PROGMEM = {0x22,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1A,0x60,0x00,0x40,0x78,0x00,0x78,0x00,0x58,0x00,0x00,0x10,0x00,0x00,0x00,0x00,0x20,0x06,0x00,0x40,0x40,0x28,0x00,0x78,0x00,0x58,0x40,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}; // Tango Accordion
-const unsigned char ym_patch_24[78] PROGMEM = {0x22,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x1C,0x60,0x00,0x00,0x78,0x00,0x78,0x00,0x28,0x00,0x00,0x18,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x40,0x00,0x78,0x10,0x18,0x00,0x40,0x00,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}; // Guitar Nylon
-const unsigned char ym_patch_25[78] PROGMEM = {0x22,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x12,0x20,0x00,0x00,0x78,0x78,0x68,0x00,0x28,0x00,0x00,0x18,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x40,0x00,0x78,0x10,0x18,0x00,0x40,0x00,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}; // Guitar Steel
-const unsigned char ym_patch_26[78] PROGMEM = {0x22,0x00,0x00,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x20,0x26,0x60,0x00,0x00,0x78,0x28,0x58,0x00,0x28,0x00,0x00,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x78,0x30,0x60,0x00,0x50,0x00,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}; // Electric Guitar (jazz)
-const unsigned char ym_patch_27[78] PROGMEM = {0x22,0x00,0x00,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x20,0x20,0x40,0x00,0x00,0x48,0x70,0x68,0x00,0x30,0x00,0x00,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x78,0x10,0x20,0x00,0x58,0x00,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}; // Electric Guitar (clean)
-const unsigned char ym_patch_28[78] PROGMEM = {0x22,0x00,0x00,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x00,0x00,0x60,0x00,0x00,0x78,0x78,0x58,0x00,0x38,0x00,0x00,0x08,0x00,0x00,0x00,0x00,0x40,0x00,0x00,0x00,0x00,0x78,0x20,0x20,0x00,0x60,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}; // Electric Guitar (muted))
-const unsigned char ym_patch_29[78] PROGMEM = {0x22,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x60,0x00,0x40,0x30,0x78,0x58,0x00,0x78,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x60,0x02,0x00,0x00,0x40,0x78,0x78,0x70,0x00,0x78,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}; // Overdriven Guitar
-const unsigned char ym_patch_30[78] PROGMEM = {0x22,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x60,0x40,0x60,0x40,0x40,0x28,0x78,0x68,0x00,0x78,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x60,0x02,0x00,0x40,0x40,0x78,0x70,0x70,0x00,0x78,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}; // Distortion Guitar
-const unsigned char ym_patch_31[78] PROGMEM = {0x22,0x00,0x00,0x00,0x00,0x00,0x60,0x00,0x00,0x00,0x60,0x04,0x20,0x00,0x00,0x40,0x30,0x50,0x00,0x48,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x38,0x10,0x68,0x00,0x50,0x00,0x40,0x20,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}; // Guitar Harmonics
-const unsigned char ym_patch_32[78] PROGMEM = {0x22,0x00,0x00,0x00,0x00,0x00,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0x78,0x70,0x50,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x40,0x78,0x00,0x78,0x00,0x78,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}; // Acoustic Bass
-const unsigned char ym_patch_33[78] PROGMEM = {0x22,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0x00,0x00,0x00,0x04,0x60,0x40,0x40,0x38,0x28,0x60,0x00,0x48,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x78,0x10,0x38,0x00,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}; // Electric Bass (finger)
-const unsigned char ym_patch_34[78] PROGMEM = {0x22,0x00,0x00,0x00,0x00,0x00,0x60,0x00,0x00,0x00,0x20,0x14,0x00,0x40,0x00,0x78,0x78,0x68,0x00,0x28,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x40,0x78,0x00,0x78,0x00,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}; // Electric Bass (pick)
-const unsigned char ym_patch_35[78] PROGMEM = {0x22,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0x00,0x00,0x00,0x1E,0x00,0x40,0x40,0x78,0x18,0x60,0x00,0x48,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x78,0x00,0x78,0x00,0x60,0x00,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}; // Fretless Bass
-const unsigned char ym_patch_36[78] PROGMEM = {0x22,0x00,0x00,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x00,0x30,0x00,0x00,0x40,0x78,0x20,0x40,0x00,0x78,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x78,0x00,0x78,0x00,0x78,0x00,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}; // Slap Bass 1
-const unsigned char ym_patch_37[78] PROGMEM = {0x22,0x00,0x00,0x00,0x00,0x00,0x30,0x00,0x00,0x00,0x20,0x00,0x00,0x40,0x00,0x78,0x00,0x78,0x00,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x40,0x78,0x00,0x78,0x00,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}; // Slap Bass 2
-const unsigned char ym_patch_38[78] PROGMEM = {0x22,0x00,0x00,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x00,0x2C,0x00,0x00,0x40,0x78,0x30,0x50,0x00,0x78,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x78,0x00,0x78,0x00,0x78,0x00,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}; // Synth Bass 1
-const unsigned char ym_patch_39[78] PROGMEM = {0x22,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x10,0x00,0x40,0x00,0x78,0x00,0x78,0x00,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x40,0x78,0x00,0x78,0x00,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}; // Synth Bass 2
-const unsigned char ym_patch_40[78] PROGMEM = {0x22,0x00,0x00,0x00,0x00,0x00,0x50,0x00,0x00,0x00,0x20,0x0A,0x40,0x40,0x40,0x40,0x68,0x60,0x00,0x38,0x00,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x40,0x18,0x40,0x70,0x00,0x30,0x00,0x40,0x08,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}; // Violin
-const unsigned char ym_patch_41[78] PROGMEM = {0x22,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x0A,0x60,0x40,0x40,0x78,0x00,0x78,0x00,0x30,0x00,0x00,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x40,0x40,0x28,0x00,0x78,0x00,0x30,0x00,0x40,0x08,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}; // Viola
-const unsigned char ym_patch_42[78] PROGMEM = {0x22,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x40,0x40,0x78,0x20,0x70,0x00,0x78,0x00,0x00,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x40,0x28,0x18,0x60,0x00,0x30,0x00,0x40,0x08,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}; // Cello
-const unsigned char ym_patch_43[78] PROGMEM = {0x22,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x60,0x40,0x40,0x78,0x20,0x70,0x00,0x78,0x00,0x00,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x40,0x30,0x18,0x60,0x00,0x30,0x00,0x40,0x08,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}; // Contrabass
-const unsigned char ym_patch_44[78] PROGMEM = {0x22,0x00,0x00,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x00,0x3A,0x00,0x40,0x40,0x78,0x10,0x58,0x00,0x18,0x40,0x00,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x40,0x28,0x08,0x68,0x00,0x40,0x40,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}; // Tremolo Strings
-const unsigned char ym_patch_45[78] PROGMEM = {0x22,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x24,0x60,0x00,0x00,0x50,0x38,0x40,0x00,0x48,0x00,0x00,0x10,0x00,0x00,0x00,0x00,0x40,0x00,0x00,0x40,0x00,0x78,0x20,0x38,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}; // Pizzicato Strings
-const unsigned char ym_patch_46[78] PROGMEM = {0x22,0x00,0x00,0x00,0x00,0x00,0x50,0x00,0x00,0x00,0x20,0x36,0x00,0x00,0x40,0x78,0x30,0x30,0x00,0x20,0x00,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x40,0x78,0x10,0x30,0x00,0x58,0x00,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}; // Orchestral Harp
-const unsigned char ym_patch_47[78] PROGMEM = {0x22,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x78,0x40,0x68,0x00,0x30,0x00,0x00,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x78,0x00,0x78,0x00,0x28,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}; // Timpani
-const unsigned char ym_patch_48[78] PROGMEM = {0x22,0x00,0x00,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x00,0x3A,0x00,0x40,0x40,0x78,0x10,0x58,0x00,0x18,0x00,0x00,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x40,0x28,0x08,0x68,0x00,0x40,0x00,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}; // String Ensembles 1
-const unsigned char ym_patch_49[78] PROGMEM = {0x22,0x00,0x00,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x20,0x2C,0x20,0x40,0x40,0x08,0x00,0x78,0x00,0x08,0x00,0x00,0x08,0x00,0x00,0x00,0x00,0x40,0x00,0x00,0x40,0x40,0x10,0x00,0x78,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}; // String Ensembles 2
-const unsigned char ym_patch_50[78] PROGMEM = {0x22,0x00,0x00,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x20,0x36,0x00,0x40,0x40,0x78,0x08,0x60,0x00,0x30,0x00,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x30,0x08,0x68,0x00,0x40,0x00,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}; // Synth Strings 1
-const unsigned char ym_patch_51[78] PROGMEM = {0x22,0x00,0x00,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x00,0x38,0x00,0x40,0x40,0x78,0x08,0x60,0x00,0x20,0x00,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x28,0x08,0x68,0x00,0x40,0x00,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}; // Synth Strings 2
-const unsigned char ym_patch_52[78] PROGMEM = {0x22,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x36,0x20,0x40,0x40,0x78,0x20,0x70,0x00,0x28,0x00,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x06,0x00,0x40,0x40,0x30,0x00,0x78,0x00,0x28,0x40,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}; // Choir Aahs
-const unsigned char ym_patch_53[78] PROGMEM = {0x22,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x0C,0x20,0x00,0x40,0x78,0x60,0x40,0x00,0x10,0x40,0x40,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x40,0x30,0x10,0x70,0x00,0x38,0x00,0x40,0x08,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}; // Voice Oohs
-const unsigned char ym_patch_54[78] PROGMEM = {0x22,0x00,0x00,0x00,0x00,0x00,0x60,0x00,0x00,0x00,0x00,0x2E,0x20,0x40,0x40,0x18,0x00,0x78,0x00,0x28,0x40,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x40,0x28,0x00,0x78,0x00,0x28,0x40,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}; // Synth Voice
-const unsigned char ym_patch_55[78] PROGMEM = {0x22,0x00,0x00,0x00,0x00,0x00,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x78,0x30,0x48,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x78,0x18,0x70,0x00,0x58,0x00,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}; // Orchestra Hit
-const unsigned char ym_patch_56[78] PROGMEM = {0x22,0x00,0x00,0x00,0x00,0x00,0x50,0x00,0x00,0x00,0x00,0x28,0x00,0x40,0x40,0x28,0x18,0x48,0x00,0x28,0x00,0x40,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x78,0x00,0x78,0x00,0x78,0x00,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}; // Trumpet
-const unsigned char ym_patch_57[78] PROGMEM = {0x22,0x00,0x00,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x00,0x2C,0x20,0x40,0x40,0x20,0x10,0x68,0x00,0x28,0x00,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x02,0x00,0x00,0x40,0x78,0x00,0x78,0x00,0x78,0x00,0x40,0x08,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}; // Trombone
-const unsigned char ym_patch_58[78] PROGMEM = {0x22,0x00,0x00,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x20,0x2A,0x20,0x00,0x40,0x28,0x10,0x68,0x00,0x28,0x00,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x02,0x00,0x00,0x40,0x48,0x18,0x68,0x00,0x48,0x00,0x40,0x08,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}; // Tuba
-const unsigned char ym_patch_59[78] PROGMEM = {0x22,0x00,0x00,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x00,0x40,0x00,0x40,0x40,0x28,0x20,0x40,0x00,0x28,0x00,0x40,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x48,0x00,0x78,0x00,0x40,0x00,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}; // Muted Trumpet
-const unsigned char ym_patch_60[78] PROGMEM = {0x22,0x00,0x00,0x00,0x00,0x00,0x50,0x00,0x00,0x00,0x00,0x30,0x00,0x00,0x40,0x28,0x08,0x68,0x00,0x30,0x00,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x78,0x00,0x78,0x00,0x38,0x00,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}; // French Horn
-const unsigned char ym_patch_61[78] PROGMEM = {0x22,0x00,0x00,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x00,0x36,0x00,0x00,0x40,0x28,0x20,0x60,0x00,0x38,0x00,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x78,0x00,0x78,0x00,0x40,0x00,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}; // Brass Section
-const unsigned char ym_patch_62[78] PROGMEM = {0x22,0x00,0x00,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x20,0x2C,0x00,0x00,0x40,0x30,0x28,0x60,0x00,0x48,0x00,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x78,0x10,0x30,0x00,0x70,0x00,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}; // Synth Brass 1
-const unsigned char ym_patch_63[78] PROGMEM = {0x22,0x00,0x00,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x00,0x3C,0x00,0x00,0x40,0x28,0x30,0x60,0x00,0x38,0x00,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x78,0x00,0x78,0x00,0x50,0x00,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}; // Synth Bass 2
-const unsigned char ym_patch_64[78] PROGMEM = {0x22,0x00,0x00,0x00,0x00,0x00,0x30,0x00,0x00,0x00,0x00,0x1C,0x20,0x00,0x40,0x30,0x00,0x78,0x00,0x20,0x00,0x00,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x40,0x40,0x28,0x00,0x78,0x00,0x48,0x00,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}; // Soprano Sax
-const unsigned char ym_patch_65[78] PROGMEM = {0x22,0x00,0x00,0x00,0x00,0x00,0x50,0x00,0x00,0x00,0x00,0x1C,0x40,0x00,0x40,0x30,0x00,0x78,0x00,0x20,0x00,0x00,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x40,0x40,0x28,0x00,0x78,0x00,0x48,0x00,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}; // Alto Sax
-const unsigned char ym_patch_66[78] PROGMEM = {0x22,0x00,0x00,0x00,0x00,0x00,0x50,0x00,0x00,0x00,0x00,0x1C,0x40,0x00,0x40,0x28,0x00,0x78,0x00,0x28,0x00,0x00,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x40,0x28,0x00,0x78,0x00,0x48,0x00,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}; // Tenor Sax
-const unsigned char ym_patch_67[78] PROGMEM = {0x22,0x00,0x00,0x00,0x00,0x00,0x50,0x00,0x00,0x00,0x00,0x1C,0x40,0x40,0x40,0x28,0x00,0x78,0x00,0x28,0x00,0x00,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x40,0x28,0x00,0x78,0x00,0x48,0x00,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}; // Baritone Sax
-const unsigned char ym_patch_68[78] PROGMEM = {0x22,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x2E,0x00,0x40,0x40,0x40,0x00,0x78,0x00,0x18,0x00,0x00,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x40,0x40,0x78,0x08,0x60,0x00,0x30,0x00,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}; // Oboe
-const unsigned char ym_patch_69[78] PROGMEM = {0x22,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x32,0x00,0x00,0x40,0x30,0x00,0x78,0x00,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x40,0x38,0x00,0x78,0x00,0x50,0x00,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}; // English Horn
-const unsigned char ym_patch_70[78] PROGMEM = {0x22,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x3C,0x00,0x00,0x40,0x28,0x00,0x78,0x00,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x30,0x00,0x78,0x00,0x50,0x00,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}; // Bassoon
-const unsigned char ym_patch_71[78] PROGMEM = {0x22,0x00,0x00,0x00,0x00,0x00,0x60,0x00,0x00,0x00,0x00,0x18,0x20,0x40,0x40,0x40,0x60,0x68,0x00,0x28,0x00,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x30,0x10,0x70,0x00,0x38,0x00,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}; // Clarinet
-const unsigned char ym_patch_72[78] PROGMEM = {0x22,0x00,0x00,0x00,0x00,0x00,0x60,0x00,0x00,0x00,0x00,0x2E,0x20,0x40,0x40,0x18,0x00,0x78,0x00,0x20,0x00,0x40,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x28,0x00,0x78,0x00,0x50,0x00,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}; // Piccolo
-const unsigned char ym_patch_73[78] PROGMEM = {0x22,0x00,0x00,0x00,0x00,0x00,0x60,0x00,0x00,0x00,0x00,0x2A,0x20,0x40,0x40,0x28,0x08,0x58,0x00,0x20,0x00,0x40,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x28,0x00,0x78,0x00,0x50,0x00,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}; // Flute
-const unsigned char ym_patch_74[78] PROGMEM = {0x22,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x3E,0x60,0x40,0x40,0x20,0x00,0x78,0x00,0x78,0x00,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x28,0x00,0x78,0x00,0x48,0x00,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}; // Recorder
-const unsigned char ym_patch_75[78] PROGMEM = {0x22,0x00,0x00,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x60,0x40,0x00,0x40,0x00,0x20,0x30,0x30,0x00,0x60,0x00,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x30,0x18,0x50,0x00,0x50,0x00,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}; // Pan Flute
-const unsigned char ym_patch_76[78] PROGMEM = {0x22,0x00,0x00,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x60,0x2E,0x00,0x40,0x40,0x38,0x28,0x30,0x00,0x68,0x00,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x28,0x00,0x78,0x00,0x48,0x00,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}; // Bottle Blow
-const unsigned char ym_patch_77[78] PROGMEM = {0x22,0x00,0x00,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x60,0x00,0x00,0x00,0x00,0x78,0x40,0x50,0x00,0x50,0x00,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x40,0x20,0x10,0x68,0x00,0x50,0x00,0x40,0x08,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}; // Shakuhachi
-const unsigned char ym_patch_78[78] PROGMEM = {0x22,0x00,0x00,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x00,0x58,0x60,0x00,0x40,0x20,0x70,0x38,0x00,0x78,0x40,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x28,0x28,0x68,0x00,0x50,0x40,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}; // Whistle
-const unsigned char ym_patch_79[78] PROGMEM = {0x22,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3E,0x60,0x40,0x40,0x20,0x00,0x78,0x00,0x78,0x00,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x38,0x00,0x78,0x00,0x48,0x00,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}; // Ocarina
-const unsigned char ym_patch_80[78] PROGMEM = {0x22,0x00,0x00,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x40,0x3A,0x20,0x00,0x40,0x78,0x00,0x78,0x00,0x78,0x00,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x78,0x00,0x78,0x00,0x78,0x00,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}; // Lead 1 (Square)
-const unsigned char ym_patch_81[78] PROGMEM = {0x22,0x00,0x00,0x00,0x00,0x00,0x60,0x00,0x00,0x00,0x00,0x1E,0x00,0x40,0x40,0x28,0x10,0x50,0x00,0x18,0x00,0x00,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x40,0x78,0x10,0x58,0x00,0x38,0x00,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}; // Lead 2 (sawtooth)
-const unsigned char ym_patch_82[78] PROGMEM = {0x22,0x00,0x00,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x60,0x2E,0x00,0x40,0x40,0x30,0x28,0x30,0x00,0x68,0x00,0x40,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x28,0x00,0x78,0x00,0x48,0x00,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}; // Lead 3 (calliope)
-const unsigned char ym_patch_83[78] PROGMEM = {0x22,0x00,0x00,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x78,0x40,0x50,0x00,0x50,0x00,0x00,0x10,0x00,0x00,0x00,0x00,0x40,0x00,0x00,0x40,0x40,0x20,0x10,0x68,0x00,0x50,0x00,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}; // Lead 4 (chiffer)
-const unsigned char ym_patch_84[78] PROGMEM = {0x22,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x60,0x00,0x40,0x78,0x20,0x50,0x00,0x38,0x00,0x00,0x08,0x00,0x00,0x00,0x00,0x40,0x00,0x00,0x40,0x40,0x78,0x10,0x68,0x00,0x40,0x00,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}; // Lead 5 (charang)
-const unsigned char ym_patch_85[78] PROGMEM = {0x22,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x0C,0x60,0x00,0x40,0x30,0x28,0x30,0x00,0x68,0x40,0x00,0x08,0x00,0x00,0x00,0x00,0x40,0x00,0x00,0x00,0x40,0x28,0x00,0x78,0x00,0x48,0x00,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}; // Lead 6 (voice)
-const unsigned char ym_patch_86[78] PROGMEM = {0x22,0x00,0x00,0x00,0x00,0x00,0x50,0x40,0x00,0x00,0x60,0x00,0x60,0x00,0x40,0x78,0x20,0x50,0x00,0x40,0x00,0x00,0x18,0x00,0x00,0x00,0x00,0x60,0x20,0x00,0x00,0x40,0x30,0x20,0x58,0x00,0x40,0x00,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}; // Lead 7 (5th sawtooth)
-const unsigned char ym_patch_87[78] PROGMEM = {0x22,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0x00,0x00,0x00,0x16,0x60,0x40,0x40,0x78,0x18,0x08,0x00,0x68,0x00,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x40,0x78,0x08,0x40,0x00,0x68,0x00,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}; // Lead 8 (bass+Lead)
-const unsigned char ym_patch_88[78] PROGMEM = {0x22,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x60,0x00,0x60,0x00,0x00,0x78,0x78,0x30,0x00,0x28,0x00,0x00,0x48,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x28,0x10,0x68,0x00,0x28,0x40,0x40,0x08,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}; // Pad 1 (New Age)
-const unsigned char ym_patch_89[78] PROGMEM = {0x22,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x30,0x20,0x40,0x40,0x10,0x00,0x78,0x00,0x28,0x00,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x40,0x18,0x00,0x78,0x00,0x30,0x00,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}; // Pad 2 (warm)
-const unsigned char ym_patch_90[78] PROGMEM = {0x22,0x00,0x00,0x00,0x00,0x00,0x50,0x00,0x00,0x00,0x00,0x1C,0x00,0x00,0x40,0x28,0x20,0x40,0x00,0x18,0x00,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x0E,0x00,0x00,0x40,0x78,0x00,0x78,0x00,0x40,0x00,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}; // Pad 3 (polysynth)
-const unsigned char ym_patch_91[78] PROGMEM = {0x22,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3A,0x20,0x40,0x40,0x18,0x00,0x78,0x00,0x18,0x40,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x40,0x20,0x00,0x78,0x00,0x20,0x40,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}; // Pad 4 (choir)
-const unsigned char ym_patch_92[78] PROGMEM = {0x22,0x00,0x00,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x40,0x4E,0x00,0x40,0x40,0x18,0x00,0x78,0x00,0x10,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x12,0x00,0x00,0x40,0x78,0x00,0x78,0x00,0x18,0x00,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}; // Pad 5 (bowed glass)
-const unsigned char ym_patch_93[78] PROGMEM = {0x22,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x60,0x46,0x20,0x00,0x00,0x10,0x00,0x78,0x00,0x20,0x00,0x00,0x08,0x00,0x00,0x00,0x00,0x40,0x00,0x00,0x40,0x40,0x10,0x00,0x78,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}; // Pad 6 (metal)
-const unsigned char ym_patch_94[78] PROGMEM = {0x22,0x00,0x00,0x00,0x00,0x00,0x30,0x00,0x00,0x00,0x00,0x32,0x40,0x00,0x00,0x28,0x10,0x50,0x00,0x40,0x00,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x20,0x08,0x60,0x00,0x30,0x40,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}; // Pad 7 (Halo)
-const unsigned char ym_patch_95[78] PROGMEM = {0x22,0x00,0x00,0x00,0x00,0x00,0x60,0x00,0x00,0x00,0x00,0x36,0x00,0x40,0x40,0x08,0x08,0x68,0x00,0x30,0x00,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x40,0x08,0x00,0x78,0x00,0x38,0x00,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}; // Pad 8 (sweep)
-const unsigned char ym_patch_96[78] PROGMEM = {0x22,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x60,0x40,0x00,0x78,0x10,0x20,0x00,0x20,0x40,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x78,0x08,0x40,0x00,0x28,0x00,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}; // FX 1 (rain)
-const unsigned char ym_patch_97[78] PROGMEM = {0x22,0x00,0x00,0x00,0x00,0x00,0x40,0x40,0x00,0x00,0x00,0x0C,0x00,0x40,0x40,0x10,0x08,0x50,0x00,0x38,0x00,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x20,0x10,0x70,0x00,0x48,0x00,0x40,0x18,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}; // FX2 (soundtrack)
-const unsigned char ym_patch_98[78] PROGMEM = {0x22,0x00,0x00,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x60,0x2A,0x00,0x00,0x00,0x48,0x78,0x38,0x00,0x28,0x40,0x00,0x28,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0x78,0x18,0x58,0x00,0x18,0x00,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}; // FX 3 (crystal)
-const unsigned char ym_patch_99[78] PROGMEM = {0x22,0x00,0x00,0x00,0x00,0x00,0x50,0x00,0x00,0x00,0x20,0x2E,0x60,0x00,0x00,0x78,0x20,0x70,0x00,0x28,0x00,0x00,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x78,0x10,0x18,0x00,0x40,0x00,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}; // FX 4 (atmosphere)
-const unsigned char ym_patch_100[78] PROGMEM = {0x22,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x22,0x00,0x00,0x00,0x78,0x18,0x30,0x00,0x28,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0x00,0x00,0x40,0x78,0x10,0x20,0x00,0x48,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}; // FX 5 (brightness)
-const unsigned char ym_patch_101[78] PROGMEM = {0x22,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1E,0x60,0x00,0x40,0x00,0x00,0x78,0x00,0x28,0x00,0x00,0x08,0x00,0x00,0x00,0x00,0x40,0x00,0x00,0x00,0x40,0x08,0x00,0x78,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}; // FX 6 (goblin)
-const unsigned char ym_patch_102[78] PROGMEM = {0x22,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x36,0x00,0x00,0x00,0x78,0x20,0x28,0x00,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0x00,0x00,0x40,0x78,0x10,0x20,0x00,0x48,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}; // FX 7 (echo drops)
-const unsigned char ym_patch_103[78] PROGMEM = {0x22,0x00,0x00,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x00,0x44,0x00,0x40,0x00,0x20,0x18,0x48,0x00,0x20,0x00,0x00,0x10,0x00,0x00,0x00,0x00,0x40,0x00,0x00,0x40,0x40,0x40,0x00,0x78,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}; // FX 8 (star-theme)
-const unsigned char ym_patch_104[78] PROGMEM = {0x22,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x78,0x10,0x30,0x00,0x40,0x00,0x00,0x08,0x00,0x00,0x00,0x00,0x20,0x12,0x00,0x00,0x00,0x78,0x18,0x10,0x00,0x28,0x00,0x00,0x38,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}; // Sitar
-const unsigned char ym_patch_105[78] PROGMEM = {0x22,0x00,0x00,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x78,0x78,0x38,0x00,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x78,0x28,0x48,0x00,0x30,0x00,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}; // Banjo
-const unsigned char ym_patch_106[78] PROGMEM = {0x22,0x00,0x00,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x40,0x00,0x40,0x40,0x00,0x78,0x78,0x40,0x00,0x28,0x00,0x00,0x10,0x00,0x00,0x00,0x00,0x40,0x00,0x00,0x40,0x00,0x78,0x18,0x08,0x00,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}; // Shamisen
-const unsigned char ym_patch_107[78] PROGMEM = {0x22,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x1E,0x00,0x00,0x00,0x78,0x20,0x48,0x00,0x18,0x00,0x00,0x10,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x78,0x28,0x48,0x00,0x20,0x00,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}; // Koto
-const unsigned char ym_patch_108[78] PROGMEM = {0x22,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x12,0x60,0x00,0x00,0x78,0x58,0x48,0x00,0x20,0x00,0x00,0x28,0x00,0x00,0x00,0x00,0x40,0x00,0x00,0x00,0x00,0x48,0x30,0x50,0x00,0x38,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}; // Kalimba
-const unsigned char ym_patch_109[78] PROGMEM = {0x22,0x00,0x00,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x20,0x18,0x00,0x40,0x00,0x78,0x78,0x20,0x00,0x10,0x00,0x00,0x18,0x00,0x00,0x00,0x00,0x60,0x14,0x00,0x40,0x40,0x28,0x00,0x78,0x00,0x78,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}; // Bag Pipe
-const unsigned char ym_patch_110[78] PROGMEM = {0x22,0x00,0x00,0x00,0x00,0x00,0x50,0x00,0x00,0x00,0x40,0x1C,0x00,0x40,0x40,0x78,0x10,0x70,0x00,0x68,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x40,0x20,0x00,0x78,0x00,0x60,0x00,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}; // Fiddle
-const unsigned char ym_patch_111[78] PROGMEM = {0x22,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x60,0x00,0x60,0x40,0x40,0x18,0x00,0x78,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0x00,0x40,0x40,0x20,0x00,0x78,0x00,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}; // Shanai
-const unsigned char ym_patch_112[78] PROGMEM = {0x22,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x60,0x00,0x60,0x00,0x40,0x78,0x78,0x40,0x00,0x28,0x00,0x00,0x28,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x78,0x70,0x60,0x00,0x18,0x00,0x00,0x18,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}; // Tinkle Bell
-const unsigned char ym_patch_113[78] PROGMEM = {0x22,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x60,0x00,0x60,0x00,0x40,0x78,0x70,0x40,0x00,0x68,0x00,0x00,0x28,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x48,0x00,0x78,0x00,0x38,0x00,0x00,0x18,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}; // Agogo
-const unsigned char ym_patch_114[78] PROGMEM = {0x22,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x38,0x60,0x00,0x00,0x20,0x00,0x78,0x00,0x18,0x00,0x00,0x38,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x30,0x00,0x78,0x00,0x28,0x00,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}; // Steel Drums
-const unsigned char ym_patch_115[78] PROGMEM = {0x22,0x00,0x00,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x00,0x00,0x60,0x00,0x00,0x78,0x68,0x28,0x00,0x18,0x00,0x00,0x38,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x78,0x48,0x40,0x00,0x40,0x00,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}; // Woodblock
-const unsigned char ym_patch_116[78] PROGMEM = {0x22,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x40,0x02,0x60,0x40,0x00,0x78,0x40,0x20,0x00,0x18,0x00,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x06,0x00,0x40,0x00,0x78,0x00,0x78,0x00,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}; // Taiko Drum
-const unsigned char ym_patch_117[78] PROGMEM = {0x22,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x78,0x00,0x78,0x00,0x60,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x78,0x00,0x78,0x00,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}; // Melodic Tom
-const unsigned char ym_patch_118[78] PROGMEM = {0x22,0x00,0x00,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x60,0x00,0x00,0x00,0x00,0x40,0x78,0x68,0x00,0x60,0x00,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x78,0x00,0x78,0x00,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}; // Synth Drum
-const unsigned char ym_patch_119[78] PROGMEM = {0x22,0x00,0x00,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x40,0x00,0x00,0x00,0x00,0x78,0x78,0x28,0x00,0x10,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x60,0x00,0x00,0x00,0x00,0x08,0x00,0x78,0x00,0x70,0x40,0x00,0x70,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}; // Reverse Cymbal
-const unsigned char ym_patch_120[78] PROGMEM = {0x22,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x28,0x78,0x50,0x00,0x60,0x00,0x00,0x70,0x00,0x00,0x00,0x00,0x20,0x04,0x00,0x00,0x00,0x40,0x38,0x48,0x00,0x60,0x00,0x00,0x70,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}; // Guitar Fret Noise
-const unsigned char ym_patch_121[78] PROGMEM = {0x22,0x00,0x00,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x00,0x00,0x60,0x40,0x00,0x78,0x78,0x30,0x00,0x10,0x00,0x00,0x08,0x00,0x00,0x00,0x00,0x60,0x00,0x00,0x40,0x00,0x18,0x00,0x78,0x00,0x30,0x00,0x00,0x70,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}; // Breath Noise
-const unsigned char ym_patch_122[78] PROGMEM = {0x22,0x00,0x00,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x20,0x00,0x78,0x00,0x18,0x00,0x00,0x70,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0x08,0x00,0x78,0x00,0x18,0x40,0x00,0x70,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}; // Seashore
-const unsigned char ym_patch_123[78] PROGMEM = {0x22,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x2A,0x40,0x40,0x00,0x18,0x38,0x28,0x00,0x18,0x40,0x00,0x58,0x00,0x00,0x00,0x00,0x40,0x00,0x00,0x40,0x00,0x20,0x30,0x60,0x00,0x38,0x00,0x00,0x50,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}; // Bird Tweet
-const unsigned char ym_patch_124[78] PROGMEM = {0x22,0x00,0x00,0x00,0x00,0x00,0x60,0x00,0x00,0x00,0x60,0x00,0x60,0x00,0x40,0x78,0x78,0x58,0x00,0x20,0x40,0x00,0x58,0x00,0x00,0x00,0x00,0x00,0x02,0x00,0x00,0x40,0x78,0x08,0x68,0x00,0x50,0x40,0x40,0x50,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}; // Telephone Ring
-const unsigned char ym_patch_125[78] PROGMEM = {0x22,0x00,0x00,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x20,0x00,0x00,0x40,0x40,0x78,0x00,0x78,0x00,0x70,0x40,0x00,0x70,0x00,0x00,0x00,0x00,0x00,0x14,0x00,0x40,0x40,0x18,0x00,0x78,0x00,0x70,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}; // Helicopter
-const unsigned char ym_patch_126[78] PROGMEM = {0x22,0x00,0x00,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x78,0x00,0x78,0x00,0x18,0x00,0x00,0x70,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x40,0x08,0x00,0x78,0x00,0x18,0x40,0x40,0x70,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}; // Applause
-const unsigned char ym_patch_127[78] PROGMEM = {0x22,0x00,0x00,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x78,0x60,0x68,0x00,0x18,0x40,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x78,0x00,0x78,0x00,0x30,0x40,0x00,0x70,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}; // Gun Shot
-const unsigned char ym_patch_128[78] PROGMEM = {0x22,0x30,0x00,0x00,0x00,0x00,0x50,0x00,0x00,0x00,0x00,0x00,0x60,0x00,0x00,0x78,0x58,0x28,0x00,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x78,0x00,0x78,0x00,0x38,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}; // Acoustic Bass Drum
-const unsigned char ym_patch_129[78] PROGMEM = {0x22,0x30,0x00,0x00,0x00,0x00,0x50,0x00,0x00,0x00,0x00,0x00,0x60,0x00,0x00,0x78,0x58,0x28,0x00,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x78,0x00,0x78,0x00,0x38,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}; // Acoustic Bass Drum
-const unsigned char ym_patch_130[78] PROGMEM = {0x22,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x60,0x00,0x00,0x78,0x68,0x18,0x00,0x10,0x00,0x00,0x28,0x00,0x00,0x00,0x00,0x60,0x00,0x00,0x40,0x00,0x78,0x48,0x10,0x00,0x48,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}; // Slide Stick
-const unsigned char ym_patch_131[78] PROGMEM = {0x22,0x3C,0x00,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x40,0x78,0x60,0x00,0x50,0x00,0x00,0x70,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x50,0x40,0x48,0x00,0x38,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}; // Acoustic Snare
-const unsigned char ym_patch_132[78] PROGMEM = {0x22,0x3C,0x00,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x40,0x00,0x00,0x00,0x00,0x40,0x18,0x68,0x00,0x60,0x00,0x00,0x28,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x48,0x48,0x50,0x00,0x40,0x00,0x00,0x18,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}; // Hand Clap
-const unsigned char ym_patch_133[78] PROGMEM = {0x22,0x46,0x00,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x40,0x00,0x00,0x00,0x00,0x40,0x20,0x50,0x00,0x60,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x78,0x40,0x38,0x00,0x50,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}; // Electric Snare
-const unsigned char ym_patch_134[78] PROGMEM = {0x22,0x33,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x78,0x78,0x78,0x00,0x60,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x78,0x78,0x78,0x00,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}; // Low Floor Tom
-const unsigned char ym_patch_135[78] PROGMEM = {0x22,0x3C,0x00,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x00,0x00,0x60,0x00,0x00,0x78,0x00,0x78,0x00,0x20,0x40,0x00,0x08,0x00,0x00,0x00,0x00,0x60,0x00,0x00,0x00,0x00,0x78,0x00,0x78,0x00,0x40,0x00,0x00,0x48,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}; // Closed High-Hat
-const unsigned char ym_patch_136[78] PROGMEM = {0x22,0x36,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x78,0x78,0x78,0x00,0x60,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x78,0x78,0x78,0x00,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}; // High Floor Tom
-const unsigned char ym_patch_137[78] PROGMEM = {0x22,0x3C,0x00,0x00,0x00,0x00,0x60,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x78,0x00,0x78,0x00,0x30,0x00,0x00,0x08,0x00,0x00,0x00,0x00,0x60,0x00,0x00,0x00,0x00,0x40,0x40,0x60,0x00,0x48,0x00,0x00,0x68,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}; // Pedal High Hat
-const unsigned char ym_patch_138[78] PROGMEM = {0x22,0x38,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x78,0x78,0x78,0x00,0x60,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x78,0x78,0x78,0x00,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}; // Low Tom
-const unsigned char ym_patch_139[78] PROGMEM = {0x22,0x3C,0x00,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x20,0x00,0x60,0x00,0x00,0x78,0x10,0x68,0x00,0x78,0x00,0x00,0x08,0x00,0x00,0x00,0x00,0x60,0x00,0x00,0x00,0x00,0x78,0x28,0x50,0x00,0x30,0x40,0x00,0x70,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}; // Open High Hat
-const unsigned char ym_patch_140[78] PROGMEM = {0x22,0x3D,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x78,0x78,0x78,0x00,0x60,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x78,0x78,0x78,0x00,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}; // Low-Mid Tom
-const unsigned char ym_patch_141[78] PROGMEM = {0x22,0x3F,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x78,0x78,0x78,0x00,0x60,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x78,0x78,0x78,0x00,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}; // High-mid Tom
-const unsigned char ym_patch_142[78] PROGMEM = {0x22,0x30,0x00,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x20,0x00,0x60,0x00,0x00,0x78,0x10,0x68,0x00,0x78,0x40,0x00,0x08,0x00,0x00,0x00,0x00,0x60,0x00,0x00,0x00,0x00,0x78,0x28,0x50,0x00,0x30,0x40,0x00,0x70,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}; // Crash Cymbal 1
-const unsigned char ym_patch_143[78] PROGMEM = {0x22,0x44,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x78,0x78,0x78,0x00,0x60,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x78,0x78,0x78,0x00,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}; // High Tom
-const unsigned char ym_patch_144[78] PROGMEM = {0x22,0x3C,0x00,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x50,0x78,0x50,0x00,0x28,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x60,0x00,0x00,0x00,0x00,0x78,0x78,0x48,0x00,0x20,0x40,0x00,0x58,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}; // Ride Cymbal 1
-const unsigned char ym_patch_145[78] PROGMEM = {0x22,0x3C,0x00,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x20,0x00,0x60,0x00,0x00,0x30,0x20,0x58,0x00,0x48,0x00,0x00,0x08,0x00,0x00,0x00,0x00,0x60,0x00,0x00,0x00,0x00,0x78,0x28,0x50,0x00,0x30,0x40,0x00,0x50,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}; // Chinses Cymbal
-const unsigned char ym_patch_146[78] PROGMEM = {0x22,0x3C,0x00,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x50,0x78,0x50,0x00,0x28,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x60,0x00,0x00,0x00,0x00,0x78,0x78,0x48,0x00,0x20,0x40,0x00,0x58,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}; // Ride Bell
-const unsigned char ym_patch_147[78] PROGMEM = {0x22,0x42,0x00,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x40,0x00,0x00,0x00,0x00,0x40,0x48,0x48,0x00,0x38,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x60,0x00,0x00,0x00,0x00,0x40,0x38,0x50,0x00,0x38,0x40,0x00,0x70,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}; // Tambourine
-const unsigned char ym_patch_148[78] PROGMEM = {0x22,0x3C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x60,0x00,0x00,0x78,0x10,0x68,0x00,0x78,0x40,0x00,0x08,0x00,0x00,0x00,0x00,0x60,0x00,0x00,0x00,0x00,0x78,0x28,0x50,0x00,0x30,0x40,0x00,0x70,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}; // Splash Cymbal
-const unsigned char ym_patch_149[78] PROGMEM = {0x22,0x3B,0x00,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x20,0x00,0x60,0x00,0x00,0x78,0x70,0x50,0x00,0x10,0x00,0x00,0x48,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x78,0x00,0x78,0x00,0x40,0x00,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}; // Cowbell
-const unsigned char ym_patch_150[78] PROGMEM = {0x22,0x40,0x00,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x20,0x00,0x60,0x00,0x00,0x78,0x10,0x68,0x00,0x78,0x40,0x00,0x08,0x00,0x00,0x00,0x00,0x60,0x00,0x00,0x00,0x00,0x78,0x28,0x50,0x00,0x30,0x40,0x00,0x70,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}; // Crash Cymbal 2
-const unsigned char ym_patch_151[78] PROGMEM = {0x22,0x30,0x00,0x00,0x00,0x00,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0x78,0x10,0x50,0x00,0x78,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0x00,0x00,0x00,0x60,0x20,0x40,0x00,0x78,0x00,0x00,0x70,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}; // Vibraslap
-const unsigned char ym_patch_152[78] PROGMEM = {0x22,0x3C,0x00,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x50,0x78,0x50,0x00,0x28,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x60,0x00,0x00,0x00,0x00,0x78,0x78,0x48,0x00,0x20,0x40,0x00,0x58,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}; // Ride Cymbal 2
-const unsigned char ym_patch_153[78] PROGMEM = {0x22,0x38,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x60,0x00,0x00,0x78,0x00,0x78,0x00,0x60,0x00,0x00,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x78,0x40,0x60,0x00,0x50,0x00,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}; // High Bongo
-const unsigned char ym_patch_154[78] PROGMEM = {0x22,0x35,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x60,0x00,0x00,0x78,0x00,0x78,0x00,0x58,0x00,0x00,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x78,0x38,0x60,0x00,0x38,0x00,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}; // Low Bango
-const unsigned char ym_patch_155[78] PROGMEM = {0x22,0x41,0x00,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x00,0x00,0x60,0x00,0x00,0x78,0x00,0x78,0x00,0x60,0x00,0x00,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x78,0x68,0x70,0x00,0x50,0x00,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}; // Mute High Conga
-const unsigned char ym_patch_156[78] PROGMEM = {0x22,0x31,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x60,0x00,0x00,0x78,0x00,0x78,0x00,0x58,0x00,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x78,0x38,0x60,0x00,0x38,0x00,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}; // Open High Conga
-const unsigned char ym_patch_157[78] PROGMEM = {0x22,0x2B,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x60,0x00,0x00,0x78,0x00,0x78,0x00,0x58,0x00,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x78,0x38,0x60,0x00,0x38,0x00,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}; // Low Conga
-const unsigned char ym_patch_158[78] PROGMEM = {0x22,0x41,0x00,0x00,0x00,0x00,0x40,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x48,0x50,0x40,0x00,0x38,0x00,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x78,0x38,0x38,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}; // High Timbale
-const unsigned char ym_patch_159[78] PROGMEM = {0x22,0x3C,0x00,0x00,0x00,0x00,0x40,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x48,0x50,0x40,0x00,0x38,0x00,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x78,0x38,0x38,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}; // Low Timbale
-const unsigned char ym_patch_160[78] PROGMEM = {0x22,0x46,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x60,0x00,0x60,0x00,0x40,0x78,0x78,0x68,0x00,0x28,0x00,0x00,0x28,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0x78,0x00,0x38,0x00,0x00,0x18,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}; // High Agogo
-const unsigned char ym_patch_161[78] PROGMEM = {0x22,0x41,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x60,0x00,0x60,0x00,0x40,0x78,0x78,0x68,0x00,0x28,0x00,0x00,0x28,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0x78,0x00,0x38,0x00,0x00,0x18,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}; // Low Agogo
-const unsigned char ym_patch_162[78] PROGMEM = {0x22,0x3C,0x00,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x00,0x00,0x60,0x40,0x00,0x48,0x00,0x78,0x00,0x40,0x00,0x00,0x08,0x00,0x00,0x00,0x00,0x60,0x00,0x00,0x00,0x00,0x40,0x48,0x50,0x00,0x38,0x40,0x00,0x70,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}; // Cabasa
-const unsigned char ym_patch_163[78] PROGMEM = {0x22,0x3C,0x00,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x78,0x08,0x70,0x00,0x58,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x60,0x00,0x00,0x40,0x00,0x40,0x58,0x58,0x00,0x30,0x40,0x00,0x70,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}; // Maracas
-const unsigned char ym_patch_164[78] PROGMEM = {0x22,0x38,0x00,0x00,0x00,0x00,0x50,0x00,0x00,0x00,0x40,0x00,0x40,0x00,0x00,0x28,0x00,0x78,0x00,0x28,0x00,0x40,0x60,0x00,0x00,0x00,0x00,0x00,0x14,0x00,0x40,0x00,0x40,0x28,0x50,0x00,0x60,0x40,0x00,0x68,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}; // Short Whistle
-const unsigned char ym_patch_165[78] PROGMEM = {0x22,0x35,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0x20,0x00,0x00,0x28,0x00,0x78,0x00,0x28,0x40,0x00,0x60,0x00,0x00,0x00,0x00,0x00,0x14,0x00,0x00,0x00,0x40,0x28,0x50,0x00,0x60,0x00,0x40,0x68,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}; // Long Whistle
-const unsigned char ym_patch_166[78] PROGMEM = {0x22,0x3C,0x00,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x40,0x00,0x00,0x00,0x00,0x78,0x00,0x78,0x00,0x30,0x40,0x00,0x58,0x00,0x00,0x00,0x00,0x60,0x00,0x00,0x40,0x00,0x78,0x30,0x58,0x00,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}; // Short Guiro
-const unsigned char ym_patch_167[78] PROGMEM = {0x22,0x30,0x00,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x60,0x00,0x00,0x00,0x00,0x78,0x38,0x30,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0x00,0x40,0x00,0x20,0x38,0x28,0x00,0x78,0x40,0x00,0x70,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}; // Long Guiro
-const unsigned char ym_patch_168[78] PROGMEM = {0x22,0x45,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0x00,0x60,0x00,0x00,0x40,0x00,0x78,0x00,0x78,0x00,0x78,0x00,0x00,0x68,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0x78,0x38,0x00,0x00,0x00,0x00,0x00,0x28,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}; // Claves
-const unsigned char ym_patch_169[78] PROGMEM = {0x22,0x43,0x00,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x00,0x00,0x60,0x00,0x00,0x78,0x68,0x28,0x00,0x18,0x00,0x00,0x38,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x78,0x48,0x40,0x00,0x40,0x00,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}; // High Wood Block
-const unsigned char ym_patch_170[78] PROGMEM = {0x22,0x3E,0x00,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x00,0x00,0x60,0x00,0x00,0x78,0x68,0x28,0x00,0x18,0x00,0x00,0x38,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x78,0x48,0x40,0x00,0x40,0x00,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}; // Low Wood Block
-const unsigned char ym_patch_171[78] PROGMEM = {0x22,0x41,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0E,0x40,0x00,0x00,0x18,0x20,0x08,0x00,0x58,0x00,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x28,0x00,0x78,0x00,0x38,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}; // Mute Cuica
-const unsigned char ym_patch_172[78] PROGMEM = {0x22,0x3C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x16,0x60,0x00,0x00,0x18,0x18,0x08,0x00,0x78,0x00,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x28,0x00,0x78,0x00,0x38,0x00,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}; // Open Cuica
-const unsigned char ym_patch_173[78] PROGMEM = {0x22,0x3F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0x40,0x00,0x00,0x78,0x78,0x20,0x00,0x10,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x40,0x08,0x00,0x40,0x00,0x40,0x38,0x70,0x00,0x40,0x00,0x00,0x48,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}; // Mute Triangle
-const unsigned char ym_patch_174[78] PROGMEM = {0x22,0x3F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0x40,0x00,0x00,0x78,0x78,0x40,0x00,0x78,0x00,0x00,0x30,0x00,0x00,0x00,0x00,0x40,0x14,0x00,0x00,0x00,0x78,0x00,0x78,0x00,0x20,0x00,0x00,0x48,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}; // Open Triangle
+const unsigned char ym_patch_0[78] PROGMEM = {0x22,0x00,0x00,0x00,0x00,0x00,0x50,0x00,0x00,0x00,0x20,0x1E,0x60,0x00,0x40,0x78,0x00,0x78,0x00,0x20,0x00,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x78,0x20,0x10,0x00,0x30,0x00,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}; // Acoustic Grand Piano
+const unsigned char ym_patch_1[78] PROGMEM = {0x22,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x0E,0x60,0x00,0x40,0x78,0x00,0x78,0x00,0x20,0x00,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x78,0x20,0x10,0x00,0x30,0x00,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}; // Bright Acoustic Piano
+const unsigned char ym_patch_2[78] PROGMEM = {0x22,0x00,0x00,0x00,0x00,0x00,0x50,0x00,0x00,0x00,0x00,0x36,0x00,0x00,0x40,0x78,0x00,0x78,0x00,0x20,0x00,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x78,0x20,0x10,0x00,0x30,0x00,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}; // Electric Grand Piano
+const unsigned char ym_patch_3[78] PROGMEM = {0x22,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x1C,0x60,0x00,0x40,0x78,0x00,0x78,0x00,0x20,0x40,0x00,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x78,0x20,0x10,0x00,0x30,0x40,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}; // Honky-tonk Piano
+const unsigned char ym_patch_4[78] PROGMEM = {0x22,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0x00,0x00,0x00,0x24,0x00,0x00,0x00,0x78,0x18,0x48,0x00,0x28,0x00,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0x78,0x08,0x40,0x00,0x68,0x00,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}; // Electric Piano 1
+const unsigned char ym_patch_5[78] PROGMEM = {0x22,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x50,0x60,0x00,0x40,0x78,0x28,0x50,0x00,0x20,0x00,0x40,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x78,0x18,0x20,0x00,0x38,0x00,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}; // Electric Piano 2
+const unsigned char ym_patch_6[78] PROGMEM = {0x22,0x00,0x00,0x00,0x00,0x00,0x50,0x00,0x00,0x00,0x20,0x0C,0x60,0x00,0x00,0x78,0x08,0x58,0x00,0x78,0x00,0x00,0x08,0x00,0x00,0x00,0x00,0x60,0x0C,0x00,0x40,0x00,0x78,0x18,0x10,0x00,0x30,0x00,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}; // Harpsichord
+const unsigned char ym_patch_7[78] PROGMEM = {0x22,0x00,0x00,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x00,0x30,0x20,0x00,0x00,0x78,0x18,0x28,0x00,0x68,0x00,0x00,0x18,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x40,0x18,0x50,0x00,0x70,0x00,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}; // Clavi
+const unsigned char ym_patch_8[78] PROGMEM = {0x22,0x00,0x00,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x00,0x28,0x60,0x00,0x40,0x20,0x60,0x70,0x00,0x78,0x00,0x00,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x78,0x30,0x58,0x00,0x28,0x00,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}; // Celesta
+const unsigned char ym_patch_9[78] PROGMEM = {0x22,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x24,0x40,0x00,0x00,0x78,0x10,0x68,0x00,0x18,0x00,0x00,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0x78,0x20,0x40,0x00,0x18,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}; // Glockenspiel
+const unsigned char ym_patch_10[78] PROGMEM = {0x22,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x48,0x20,0x40,0x00,0x30,0x10,0x68,0x00,0x78,0x00,0x00,0x30,0x00,0x00,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x78,0x20,0x48,0x00,0x50,0x00,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}; // Music Box
+const unsigned char ym_patch_11[78] PROGMEM = {0x22,0x00,0x00,0x00,0x00,0x00,0x10,0x40,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x78,0x28,0x60,0x00,0x30,0x00,0x00,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x78,0x68,0x68,0x00,0x28,0x00,0x40,0x08,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}; // Vibraphone
+const unsigned char ym_patch_12[78] PROGMEM = {0x22,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x2A,0x60,0x00,0x00,0x30,0x68,0x70,0x00,0x38,0x00,0x00,0x50,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x78,0x00,0x78,0x00,0x28,0x00,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}; // Marimba
+const unsigned char ym_patch_13[78] PROGMEM = {0x22,0x00,0x00,0x00,0x00,0x00,0x60,0x00,0x00,0x00,0x40,0x10,0x60,0x40,0x00,0x78,0x40,0x48,0x00,0x28,0x00,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x78,0x30,0x10,0x00,0x38,0x00,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}; // Xylophone
+const unsigned char ym_patch_14[78] PROGMEM = {0x22,0x00,0x00,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x78,0x78,0x30,0x00,0x10,0x40,0x00,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0x78,0x00,0x78,0x00,0x18,0x00,0x00,0x28,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}; // Tubular Bells
+const unsigned char ym_patch_15[78] PROGMEM = {0x22,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x60,0x00,0x00,0x40,0x58,0x60,0x00,0x40,0x00,0x00,0x18,0x00,0x00,0x00,0x00,0x40,0x00,0x00,0x00,0x00,0x40,0x18,0x60,0x00,0x48,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}; // Dulcimer
+const unsigned char ym_patch_16[78] PROGMEM = {0x22,0x00,0x00,0x00,0x00,0x00,0x60,0x40,0x00,0x00,0x00,0x00,0x60,0x00,0x40,0x78,0x00,0x78,0x00,0x78,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0C,0x00,0x00,0x40,0x78,0x00,0x78,0x00,0x78,0x40,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}; // Hammond Organ
+const unsigned char ym_patch_17[78] PROGMEM = {0x22,0x00,0x00,0x00,0x00,0x00,0x70,0x40,0x00,0x00,0x40,0x00,0x00,0x00,0x40,0x78,0x78,0x30,0x00,0x78,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x40,0x78,0x00,0x78,0x00,0x78,0x00,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}; // Percussive Organ
+const unsigned char ym_patch_18[78] PROGMEM = {0x22,0x00,0x00,0x00,0x00,0x00,0x30,0x40,0x00,0x00,0x20,0x00,0x00,0x40,0x40,0x78,0x78,0x70,0x00,0x78,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x40,0x40,0x28,0x70,0x58,0x00,0x60,0x00,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}; // Rock Organ
+const unsigned char ym_patch_19[78] PROGMEM = {0x22,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0x00,0x20,0x24,0x00,0x00,0x40,0x78,0x00,0x78,0x00,0x58,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x40,0x00,0x00,0x40,0x40,0x28,0x00,0x78,0x00,0x58,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}; // Church Organ
+const unsigned char ym_patch_20[78] PROGMEM = {0x22,0x00,0x00,0x00,0x00,0x00,0x70,0x40,0x00,0x00,0x20,0x12,0x20,0x00,0x40,0x78,0x00,0x78,0x00,0x58,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x40,0x00,0x00,0x40,0x40,0x28,0x00,0x78,0x00,0x58,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}; // Reed Organ
+const unsigned char ym_patch_21[78] PROGMEM = {0x22,0x00,0x00,0x00,0x00,0x00,0x50,0x00,0x00,0x00,0x00,0x18,0x60,0x00,0x40,0x78,0x00,0x78,0x00,0x58,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x20,0x14,0x00,0x40,0x40,0x28,0x00,0x78,0x00,0x58,0x00,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}; // Accordion
+const unsigned char ym_patch_22[78] PROGMEM = {0x22,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x14,0x60,0x00,0x40,0x30,0x78,0x68,0x00,0x78,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x40,0x14,0x00,0x40,0x40,0x20,0x00,0x78,0x00,0x68,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}; // Harmonica
+const unsigned char ym_patch_23[78] PROGMEM = {0x22,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1A,0x60,0x00,0x40,0x78,0x00,0x78,0x00,0x58,0x00,0x00,0x10,0x00,0x00,0x00,0x00,0x20,0x06,0x00,0x40,0x40,0x28,0x00,0x78,0x00,0x58,0x40,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}; // Tango Accordion
+const unsigned char ym_patch_24[78] PROGMEM = {0x22,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x1C,0x60,0x00,0x00,0x78,0x00,0x78,0x00,0x28,0x00,0x00,0x18,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x40,0x00,0x78,0x10,0x18,0x00,0x40,0x00,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}; // Guitar Nylon
+const unsigned char ym_patch_25[78] PROGMEM = {0x22,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x12,0x20,0x00,0x00,0x78,0x78,0x68,0x00,0x28,0x00,0x00,0x18,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x40,0x00,0x78,0x10,0x18,0x00,0x40,0x00,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}; // Guitar Steel
+const unsigned char ym_patch_26[78] PROGMEM = {0x22,0x00,0x00,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x20,0x26,0x60,0x00,0x00,0x78,0x28,0x58,0x00,0x28,0x00,0x00,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x78,0x30,0x60,0x00,0x50,0x00,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}; // Electric Guitar (jazz)
+const unsigned char ym_patch_27[78] PROGMEM = {0x22,0x00,0x00,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x20,0x20,0x40,0x00,0x00,0x48,0x70,0x68,0x00,0x30,0x00,0x00,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x78,0x10,0x20,0x00,0x58,0x00,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}; // Electric Guitar (clean)
+const unsigned char ym_patch_28[78] PROGMEM = {0x22,0x00,0x00,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x00,0x00,0x60,0x00,0x00,0x78,0x78,0x58,0x00,0x38,0x00,0x00,0x08,0x00,0x00,0x00,0x00,0x40,0x00,0x00,0x00,0x00,0x78,0x20,0x20,0x00,0x60,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}; // Electric Guitar (muted))
+const unsigned char ym_patch_29[78] PROGMEM = {0x22,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x60,0x00,0x40,0x30,0x78,0x58,0x00,0x78,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x60,0x02,0x00,0x00,0x40,0x78,0x78,0x70,0x00,0x78,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}; // Overdriven Guitar
+const unsigned char ym_patch_30[78] PROGMEM = {0x22,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x60,0x40,0x60,0x40,0x40,0x28,0x78,0x68,0x00,0x78,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x60,0x02,0x00,0x40,0x40,0x78,0x70,0x70,0x00,0x78,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}; // Distortion Guitar
+const unsigned char ym_patch_31[78] PROGMEM = {0x22,0x00,0x00,0x00,0x00,0x00,0x60,0x00,0x00,0x00,0x60,0x04,0x20,0x00,0x00,0x40,0x30,0x50,0x00,0x48,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x38,0x10,0x68,0x00,0x50,0x00,0x40,0x20,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}; // Guitar Harmonics
+const unsigned char ym_patch_32[78] PROGMEM = {0x22,0x00,0x00,0x00,0x00,0x00,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0x78,0x70,0x50,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x40,0x78,0x00,0x78,0x00,0x78,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}; // Acoustic Bass
+const unsigned char ym_patch_33[78] PROGMEM = {0x22,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0x00,0x00,0x00,0x04,0x60,0x40,0x40,0x38,0x28,0x60,0x00,0x48,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x78,0x10,0x38,0x00,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}; // Electric Bass (finger)
+const unsigned char ym_patch_34[78] PROGMEM = {0x22,0x00,0x00,0x00,0x00,0x00,0x60,0x00,0x00,0x00,0x20,0x14,0x00,0x40,0x00,0x78,0x78,0x68,0x00,0x28,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x40,0x78,0x00,0x78,0x00,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}; // Electric Bass (pick)
+const unsigned char ym_patch_35[78] PROGMEM = {0x22,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0x00,0x00,0x00,0x1E,0x00,0x40,0x40,0x78,0x18,0x60,0x00,0x48,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x78,0x00,0x78,0x00,0x60,0x00,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}; // Fretless Bass
+const unsigned char ym_patch_36[78] PROGMEM = {0x22,0x00,0x00,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x00,0x30,0x00,0x00,0x40,0x78,0x20,0x40,0x00,0x78,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x78,0x00,0x78,0x00,0x78,0x00,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}; // Slap Bass 1
+const unsigned char ym_patch_37[78] PROGMEM = {0x22,0x00,0x00,0x00,0x00,0x00,0x30,0x00,0x00,0x00,0x20,0x00,0x00,0x40,0x00,0x78,0x00,0x78,0x00,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x40,0x78,0x00,0x78,0x00,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}; // Slap Bass 2
+const unsigned char ym_patch_38[78] PROGMEM = {0x22,0x00,0x00,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x00,0x2C,0x00,0x00,0x40,0x78,0x30,0x50,0x00,0x78,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x78,0x00,0x78,0x00,0x78,0x00,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}; // Synth Bass 1
+const unsigned char ym_patch_39[78] PROGMEM = {0x22,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x10,0x00,0x40,0x00,0x78,0x00,0x78,0x00,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x40,0x78,0x00,0x78,0x00,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}; // Synth Bass 2
+const unsigned char ym_patch_40[78] PROGMEM = {0x22,0x00,0x00,0x00,0x00,0x00,0x50,0x00,0x00,0x00,0x20,0x0A,0x40,0x40,0x40,0x40,0x68,0x60,0x00,0x38,0x00,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x40,0x18,0x40,0x70,0x00,0x30,0x00,0x40,0x08,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}; // Violin
+const unsigned char ym_patch_41[78] PROGMEM = {0x22,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x0A,0x60,0x40,0x40,0x78,0x00,0x78,0x00,0x30,0x00,0x00,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x40,0x40,0x28,0x00,0x78,0x00,0x30,0x00,0x40,0x08,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}; // Viola
+const unsigned char ym_patch_42[78] PROGMEM = {0x22,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x40,0x40,0x78,0x20,0x70,0x00,0x78,0x00,0x00,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x40,0x28,0x18,0x60,0x00,0x30,0x00,0x40,0x08,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}; // Cello
+const unsigned char ym_patch_43[78] PROGMEM = {0x22,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x60,0x40,0x40,0x78,0x20,0x70,0x00,0x78,0x00,0x00,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x40,0x30,0x18,0x60,0x00,0x30,0x00,0x40,0x08,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}; // Contrabass
+const unsigned char ym_patch_44[78] PROGMEM = {0x22,0x00,0x00,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x00,0x3A,0x00,0x40,0x40,0x78,0x10,0x58,0x00,0x18,0x40,0x00,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x40,0x28,0x08,0x68,0x00,0x40,0x40,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}; // Tremolo Strings
+const unsigned char ym_patch_45[78] PROGMEM = {0x22,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x24,0x60,0x00,0x00,0x50,0x38,0x40,0x00,0x48,0x00,0x00,0x10,0x00,0x00,0x00,0x00,0x40,0x00,0x00,0x40,0x00,0x78,0x20,0x38,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}; // Pizzicato Strings
+const unsigned char ym_patch_46[78] PROGMEM = {0x22,0x00,0x00,0x00,0x00,0x00,0x50,0x00,0x00,0x00,0x20,0x36,0x00,0x00,0x40,0x78,0x30,0x30,0x00,0x20,0x00,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x40,0x78,0x10,0x30,0x00,0x58,0x00,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}; // Orchestral Harp
+const unsigned char ym_patch_47[78] PROGMEM = {0x22,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x78,0x40,0x68,0x00,0x30,0x00,0x00,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x78,0x00,0x78,0x00,0x28,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}; // Timpani
+const unsigned char ym_patch_48[78] PROGMEM = {0x22,0x00,0x00,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x00,0x3A,0x00,0x40,0x40,0x78,0x10,0x58,0x00,0x18,0x00,0x00,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x40,0x28,0x08,0x68,0x00,0x40,0x00,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}; // String Ensembles 1
+const unsigned char ym_patch_49[78] PROGMEM = {0x22,0x00,0x00,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x20,0x2C,0x20,0x40,0x40,0x08,0x00,0x78,0x00,0x08,0x00,0x00,0x08,0x00,0x00,0x00,0x00,0x40,0x00,0x00,0x40,0x40,0x10,0x00,0x78,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}; // String Ensembles 2
+const unsigned char ym_patch_50[78] PROGMEM = {0x22,0x00,0x00,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x20,0x36,0x00,0x40,0x40,0x78,0x08,0x60,0x00,0x30,0x00,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x30,0x08,0x68,0x00,0x40,0x00,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}; // Synth Strings 1
+const unsigned char ym_patch_51[78] PROGMEM = {0x22,0x00,0x00,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x00,0x38,0x00,0x40,0x40,0x78,0x08,0x60,0x00,0x20,0x00,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x28,0x08,0x68,0x00,0x40,0x00,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}; // Synth Strings 2
+const unsigned char ym_patch_52[78] PROGMEM = {0x22,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x36,0x20,0x40,0x40,0x78,0x20,0x70,0x00,0x28,0x00,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x06,0x00,0x40,0x40,0x30,0x00,0x78,0x00,0x28,0x40,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}; // Choir Aahs
+const unsigned char ym_patch_53[78] PROGMEM = {0x22,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x0C,0x20,0x00,0x40,0x78,0x60,0x40,0x00,0x10,0x40,0x40,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x40,0x30,0x10,0x70,0x00,0x38,0x00,0x40,0x08,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}; // Voice Oohs
+const unsigned char ym_patch_54[78] PROGMEM = {0x22,0x00,0x00,0x00,0x00,0x00,0x60,0x00,0x00,0x00,0x00,0x2E,0x20,0x40,0x40,0x18,0x00,0x78,0x00,0x28,0x40,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x40,0x28,0x00,0x78,0x00,0x28,0x40,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}; // Synth Voice
+const unsigned char ym_patch_55[78] PROGMEM = {0x22,0x00,0x00,0x00,0x00,0x00,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x78,0x30,0x48,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x78,0x18,0x70,0x00,0x58,0x00,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}; // Orchestra Hit
+const unsigned char ym_patch_56[78] PROGMEM = {0x22,0x00,0x00,0x00,0x00,0x00,0x50,0x00,0x00,0x00,0x00,0x28,0x00,0x40,0x40,0x28,0x18,0x48,0x00,0x28,0x00,0x40,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x78,0x00,0x78,0x00,0x78,0x00,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}; // Trumpet
+const unsigned char ym_patch_57[78] PROGMEM = {0x22,0x00,0x00,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x00,0x2C,0x20,0x40,0x40,0x20,0x10,0x68,0x00,0x28,0x00,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x02,0x00,0x00,0x40,0x78,0x00,0x78,0x00,0x78,0x00,0x40,0x08,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}; // Trombone
+const unsigned char ym_patch_58[78] PROGMEM = {0x22,0x00,0x00,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x20,0x2A,0x20,0x00,0x40,0x28,0x10,0x68,0x00,0x28,0x00,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x02,0x00,0x00,0x40,0x48,0x18,0x68,0x00,0x48,0x00,0x40,0x08,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}; // Tuba
+const unsigned char ym_patch_59[78] PROGMEM = {0x22,0x00,0x00,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x00,0x40,0x00,0x40,0x40,0x28,0x20,0x40,0x00,0x28,0x00,0x40,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x48,0x00,0x78,0x00,0x40,0x00,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}; // Muted Trumpet
+const unsigned char ym_patch_60[78] PROGMEM = {0x22,0x00,0x00,0x00,0x00,0x00,0x50,0x00,0x00,0x00,0x00,0x30,0x00,0x00,0x40,0x28,0x08,0x68,0x00,0x30,0x00,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x78,0x00,0x78,0x00,0x38,0x00,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}; // French Horn
+const unsigned char ym_patch_61[78] PROGMEM = {0x22,0x00,0x00,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x00,0x36,0x00,0x00,0x40,0x28,0x20,0x60,0x00,0x38,0x00,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x78,0x00,0x78,0x00,0x40,0x00,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}; // Brass Section
+const unsigned char ym_patch_62[78] PROGMEM = {0x22,0x00,0x00,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x20,0x2C,0x00,0x00,0x40,0x30,0x28,0x60,0x00,0x48,0x00,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x78,0x10,0x30,0x00,0x70,0x00,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}; // Synth Brass 1
+const unsigned char ym_patch_63[78] PROGMEM = {0x22,0x00,0x00,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x00,0x3C,0x00,0x00,0x40,0x28,0x30,0x60,0x00,0x38,0x00,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x78,0x00,0x78,0x00,0x50,0x00,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}; // Synth Bass 2
+const unsigned char ym_patch_64[78] PROGMEM = {0x22,0x00,0x00,0x00,0x00,0x00,0x30,0x00,0x00,0x00,0x00,0x1C,0x20,0x00,0x40,0x30,0x00,0x78,0x00,0x20,0x00,0x00,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x40,0x40,0x28,0x00,0x78,0x00,0x48,0x00,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}; // Soprano Sax
+const unsigned char ym_patch_65[78] PROGMEM = {0x22,0x00,0x00,0x00,0x00,0x00,0x50,0x00,0x00,0x00,0x00,0x1C,0x40,0x00,0x40,0x30,0x00,0x78,0x00,0x20,0x00,0x00,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x40,0x40,0x28,0x00,0x78,0x00,0x48,0x00,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}; // Alto Sax
+const unsigned char ym_patch_66[78] PROGMEM = {0x22,0x00,0x00,0x00,0x00,0x00,0x50,0x00,0x00,0x00,0x00,0x1C,0x40,0x00,0x40,0x28,0x00,0x78,0x00,0x28,0x00,0x00,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x40,0x28,0x00,0x78,0x00,0x48,0x00,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}; // Tenor Sax
+const unsigned char ym_patch_67[78] PROGMEM = {0x22,0x00,0x00,0x00,0x00,0x00,0x50,0x00,0x00,0x00,0x00,0x1C,0x40,0x40,0x40,0x28,0x00,0x78,0x00,0x28,0x00,0x00,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x40,0x28,0x00,0x78,0x00,0x48,0x00,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}; // Baritone Sax
+const unsigned char ym_patch_68[78] PROGMEM = {0x22,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x2E,0x00,0x40,0x40,0x40,0x00,0x78,0x00,0x18,0x00,0x00,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x40,0x40,0x78,0x08,0x60,0x00,0x30,0x00,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}; // Oboe
+const unsigned char ym_patch_69[78] PROGMEM = {0x22,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x32,0x00,0x00,0x40,0x30,0x00,0x78,0x00,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x40,0x38,0x00,0x78,0x00,0x50,0x00,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}; // English Horn
+const unsigned char ym_patch_70[78] PROGMEM = {0x22,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x3C,0x00,0x00,0x40,0x28,0x00,0x78,0x00,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x30,0x00,0x78,0x00,0x50,0x00,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}; // Bassoon
+const unsigned char ym_patch_71[78] PROGMEM = {0x22,0x00,0x00,0x00,0x00,0x00,0x60,0x00,0x00,0x00,0x00,0x18,0x20,0x40,0x40,0x40,0x60,0x68,0x00,0x28,0x00,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x30,0x10,0x70,0x00,0x38,0x00,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}; // Clarinet
+const unsigned char ym_patch_72[78] PROGMEM = {0x22,0x00,0x00,0x00,0x00,0x00,0x60,0x00,0x00,0x00,0x00,0x2E,0x20,0x40,0x40,0x18,0x00,0x78,0x00,0x20,0x00,0x40,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x28,0x00,0x78,0x00,0x50,0x00,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}; // Piccolo
+const unsigned char ym_patch_73[78] PROGMEM = {0x22,0x00,0x00,0x00,0x00,0x00,0x60,0x00,0x00,0x00,0x00,0x2A,0x20,0x40,0x40,0x28,0x08,0x58,0x00,0x20,0x00,0x40,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x28,0x00,0x78,0x00,0x50,0x00,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}; // Flute
+const unsigned char ym_patch_74[78] PROGMEM = {0x22,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x3E,0x60,0x40,0x40,0x20,0x00,0x78,0x00,0x78,0x00,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x28,0x00,0x78,0x00,0x48,0x00,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}; // Recorder
+const unsigned char ym_patch_75[78] PROGMEM = {0x22,0x00,0x00,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x60,0x40,0x00,0x40,0x00,0x20,0x30,0x30,0x00,0x60,0x00,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x30,0x18,0x50,0x00,0x50,0x00,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}; // Pan Flute
+const unsigned char ym_patch_76[78] PROGMEM = {0x22,0x00,0x00,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x60,0x2E,0x00,0x40,0x40,0x38,0x28,0x30,0x00,0x68,0x00,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x28,0x00,0x78,0x00,0x48,0x00,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}; // Bottle Blow
+const unsigned char ym_patch_77[78] PROGMEM = {0x22,0x00,0x00,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x60,0x00,0x00,0x00,0x00,0x78,0x40,0x50,0x00,0x50,0x00,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x40,0x20,0x10,0x68,0x00,0x50,0x00,0x40,0x08,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}; // Shakuhachi
+const unsigned char ym_patch_78[78] PROGMEM = {0x22,0x00,0x00,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x00,0x58,0x60,0x00,0x40,0x20,0x70,0x38,0x00,0x78,0x40,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x28,0x28,0x68,0x00,0x50,0x40,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}; // Whistle
+const unsigned char ym_patch_79[78] PROGMEM = {0x22,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3E,0x60,0x40,0x40,0x20,0x00,0x78,0x00,0x78,0x00,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x38,0x00,0x78,0x00,0x48,0x00,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}; // Ocarina
+const unsigned char ym_patch_80[78] PROGMEM = {0x22,0x00,0x00,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x40,0x3A,0x20,0x00,0x40,0x78,0x00,0x78,0x00,0x78,0x00,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x78,0x00,0x78,0x00,0x78,0x00,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}; // Lead 1 (Square)
+const unsigned char ym_patch_81[78] PROGMEM = {0x22,0x00,0x00,0x00,0x00,0x00,0x60,0x00,0x00,0x00,0x00,0x1E,0x00,0x40,0x40,0x28,0x10,0x50,0x00,0x18,0x00,0x00,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x40,0x78,0x10,0x58,0x00,0x38,0x00,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}; // Lead 2 (sawtooth)
+const unsigned char ym_patch_82[78] PROGMEM = {0x22,0x00,0x00,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x60,0x2E,0x00,0x40,0x40,0x30,0x28,0x30,0x00,0x68,0x00,0x40,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x28,0x00,0x78,0x00,0x48,0x00,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}; // Lead 3 (calliope)
+const unsigned char ym_patch_83[78] PROGMEM = {0x22,0x00,0x00,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x78,0x40,0x50,0x00,0x50,0x00,0x00,0x10,0x00,0x00,0x00,0x00,0x40,0x00,0x00,0x40,0x40,0x20,0x10,0x68,0x00,0x50,0x00,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}; // Lead 4 (chiffer)
+const unsigned char ym_patch_84[78] PROGMEM = {0x22,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x60,0x00,0x40,0x78,0x20,0x50,0x00,0x38,0x00,0x00,0x08,0x00,0x00,0x00,0x00,0x40,0x00,0x00,0x40,0x40,0x78,0x10,0x68,0x00,0x40,0x00,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}; // Lead 5 (charang)
+const unsigned char ym_patch_85[78] PROGMEM = {0x22,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x0C,0x60,0x00,0x40,0x30,0x28,0x30,0x00,0x68,0x40,0x00,0x08,0x00,0x00,0x00,0x00,0x40,0x00,0x00,0x00,0x40,0x28,0x00,0x78,0x00,0x48,0x00,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}; // Lead 6 (voice)
+const unsigned char ym_patch_86[78] PROGMEM = {0x22,0x00,0x00,0x00,0x00,0x00,0x50,0x40,0x00,0x00,0x60,0x00,0x60,0x00,0x40,0x78,0x20,0x50,0x00,0x40,0x00,0x00,0x18,0x00,0x00,0x00,0x00,0x60,0x20,0x00,0x00,0x40,0x30,0x20,0x58,0x00,0x40,0x00,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}; // Lead 7 (5th sawtooth)
+const unsigned char ym_patch_87[78] PROGMEM = {0x22,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0x00,0x00,0x00,0x16,0x60,0x40,0x40,0x78,0x18,0x08,0x00,0x68,0x00,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x40,0x78,0x08,0x40,0x00,0x68,0x00,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}; // Lead 8 (bass+Lead)
+const unsigned char ym_patch_88[78] PROGMEM = {0x22,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x60,0x00,0x60,0x00,0x00,0x78,0x78,0x30,0x00,0x28,0x00,0x00,0x48,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x28,0x10,0x68,0x00,0x28,0x40,0x40,0x08,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}; // Pad 1 (New Age)
+const unsigned char ym_patch_89[78] PROGMEM = {0x22,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x30,0x20,0x40,0x40,0x10,0x00,0x78,0x00,0x28,0x00,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x40,0x18,0x00,0x78,0x00,0x30,0x00,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}; // Pad 2 (warm)
+const unsigned char ym_patch_90[78] PROGMEM = {0x22,0x00,0x00,0x00,0x00,0x00,0x50,0x00,0x00,0x00,0x00,0x1C,0x00,0x00,0x40,0x28,0x20,0x40,0x00,0x18,0x00,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x0E,0x00,0x00,0x40,0x78,0x00,0x78,0x00,0x40,0x00,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}; // Pad 3 (polysynth)
+const unsigned char ym_patch_91[78] PROGMEM = {0x22,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3A,0x20,0x40,0x40,0x18,0x00,0x78,0x00,0x18,0x40,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x40,0x20,0x00,0x78,0x00,0x20,0x40,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}; // Pad 4 (choir)
+const unsigned char ym_patch_92[78] PROGMEM = {0x22,0x00,0x00,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x40,0x4E,0x00,0x40,0x40,0x18,0x00,0x78,0x00,0x10,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x12,0x00,0x00,0x40,0x78,0x00,0x78,0x00,0x18,0x00,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}; // Pad 5 (bowed glass)
+const unsigned char ym_patch_93[78] PROGMEM = {0x22,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x60,0x46,0x20,0x00,0x00,0x10,0x00,0x78,0x00,0x20,0x00,0x00,0x08,0x00,0x00,0x00,0x00,0x40,0x00,0x00,0x40,0x40,0x10,0x00,0x78,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}; // Pad 6 (metal)
+const unsigned char ym_patch_94[78] PROGMEM = {0x22,0x00,0x00,0x00,0x00,0x00,0x30,0x00,0x00,0x00,0x00,0x32,0x40,0x00,0x00,0x28,0x10,0x50,0x00,0x40,0x00,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x20,0x08,0x60,0x00,0x30,0x40,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}; // Pad 7 (Halo)
+const unsigned char ym_patch_95[78] PROGMEM = {0x22,0x00,0x00,0x00,0x00,0x00,0x60,0x00,0x00,0x00,0x00,0x36,0x00,0x40,0x40,0x08,0x08,0x68,0x00,0x30,0x00,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x40,0x08,0x00,0x78,0x00,0x38,0x00,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}; // Pad 8 (sweep)
+const unsigned char ym_patch_96[78] PROGMEM = {0x22,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x60,0x40,0x00,0x78,0x10,0x20,0x00,0x20,0x40,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x78,0x08,0x40,0x00,0x28,0x00,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}; // FX 1 (rain)
+const unsigned char ym_patch_97[78] PROGMEM = {0x22,0x00,0x00,0x00,0x00,0x00,0x40,0x40,0x00,0x00,0x00,0x0C,0x00,0x40,0x40,0x10,0x08,0x50,0x00,0x38,0x00,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x20,0x10,0x70,0x00,0x48,0x00,0x40,0x18,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}; // FX2 (soundtrack)
+const unsigned char ym_patch_98[78] PROGMEM = {0x22,0x00,0x00,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x60,0x2A,0x00,0x00,0x00,0x48,0x78,0x38,0x00,0x28,0x40,0x00,0x28,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0x78,0x18,0x58,0x00,0x18,0x00,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}; // FX 3 (crystal)
+const unsigned char ym_patch_99[78] PROGMEM = {0x22,0x00,0x00,0x00,0x00,0x00,0x50,0x00,0x00,0x00,0x20,0x2E,0x60,0x00,0x00,0x78,0x20,0x70,0x00,0x28,0x00,0x00,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x78,0x10,0x18,0x00,0x40,0x00,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}; // FX 4 (atmosphere)
+const unsigned char ym_patch_100[78] PROGMEM = {0x22,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x22,0x00,0x00,0x00,0x78,0x18,0x30,0x00,0x28,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0x00,0x00,0x40,0x78,0x10,0x20,0x00,0x48,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}; // FX 5 (brightness)
+const unsigned char ym_patch_101[78] PROGMEM = {0x22,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1E,0x60,0x00,0x40,0x00,0x00,0x78,0x00,0x28,0x00,0x00,0x08,0x00,0x00,0x00,0x00,0x40,0x00,0x00,0x00,0x40,0x08,0x00,0x78,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}; // FX 6 (goblin)
+const unsigned char ym_patch_102[78] PROGMEM = {0x22,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x36,0x00,0x00,0x00,0x78,0x20,0x28,0x00,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0x00,0x00,0x40,0x78,0x10,0x20,0x00,0x48,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}; // FX 7 (echo drops)
+const unsigned char ym_patch_103[78] PROGMEM = {0x22,0x00,0x00,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x00,0x44,0x00,0x40,0x00,0x20,0x18,0x48,0x00,0x20,0x00,0x00,0x10,0x00,0x00,0x00,0x00,0x40,0x00,0x00,0x40,0x40,0x40,0x00,0x78,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}; // FX 8 (star-theme)
+const unsigned char ym_patch_104[78] PROGMEM = {0x22,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x78,0x10,0x30,0x00,0x40,0x00,0x00,0x08,0x00,0x00,0x00,0x00,0x20,0x12,0x00,0x00,0x00,0x78,0x18,0x10,0x00,0x28,0x00,0x00,0x38,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}; // Sitar
+const unsigned char ym_patch_105[78] PROGMEM = {0x22,0x00,0x00,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x78,0x78,0x38,0x00,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x78,0x28,0x48,0x00,0x30,0x00,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}; // Banjo
+const unsigned char ym_patch_106[78] PROGMEM = {0x22,0x00,0x00,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x40,0x00,0x40,0x40,0x00,0x78,0x78,0x40,0x00,0x28,0x00,0x00,0x10,0x00,0x00,0x00,0x00,0x40,0x00,0x00,0x40,0x00,0x78,0x18,0x08,0x00,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}; // Shamisen
+const unsigned char ym_patch_107[78] PROGMEM = {0x22,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x1E,0x00,0x00,0x00,0x78,0x20,0x48,0x00,0x18,0x00,0x00,0x10,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x78,0x28,0x48,0x00,0x20,0x00,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}; // Koto
+const unsigned char ym_patch_108[78] PROGMEM = {0x22,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x12,0x60,0x00,0x00,0x78,0x58,0x48,0x00,0x20,0x00,0x00,0x28,0x00,0x00,0x00,0x00,0x40,0x00,0x00,0x00,0x00,0x48,0x30,0x50,0x00,0x38,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}; // Kalimba
+const unsigned char ym_patch_109[78] PROGMEM = {0x22,0x00,0x00,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x20,0x18,0x00,0x40,0x00,0x78,0x78,0x20,0x00,0x10,0x00,0x00,0x18,0x00,0x00,0x00,0x00,0x60,0x14,0x00,0x40,0x40,0x28,0x00,0x78,0x00,0x78,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}; // Bag Pipe
+const unsigned char ym_patch_110[78] PROGMEM = {0x22,0x00,0x00,0x00,0x00,0x00,0x50,0x00,0x00,0x00,0x40,0x1C,0x00,0x40,0x40,0x78,0x10,0x70,0x00,0x68,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x40,0x20,0x00,0x78,0x00,0x60,0x00,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}; // Fiddle
+const unsigned char ym_patch_111[78] PROGMEM = {0x22,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x60,0x00,0x60,0x40,0x40,0x18,0x00,0x78,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0x00,0x40,0x40,0x20,0x00,0x78,0x00,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}; // Shanai
+const unsigned char ym_patch_112[78] PROGMEM = {0x22,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x60,0x00,0x60,0x00,0x40,0x78,0x78,0x40,0x00,0x28,0x00,0x00,0x28,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x78,0x70,0x60,0x00,0x18,0x00,0x00,0x18,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}; // Tinkle Bell
+const unsigned char ym_patch_113[78] PROGMEM = {0x22,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x60,0x00,0x60,0x00,0x40,0x78,0x70,0x40,0x00,0x68,0x00,0x00,0x28,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x48,0x00,0x78,0x00,0x38,0x00,0x00,0x18,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}; // Agogo
+const unsigned char ym_patch_114[78] PROGMEM = {0x22,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x38,0x60,0x00,0x00,0x20,0x00,0x78,0x00,0x18,0x00,0x00,0x38,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x30,0x00,0x78,0x00,0x28,0x00,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}; // Steel Drums
+const unsigned char ym_patch_115[78] PROGMEM = {0x22,0x00,0x00,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x00,0x00,0x60,0x00,0x00,0x78,0x68,0x28,0x00,0x18,0x00,0x00,0x38,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x78,0x48,0x40,0x00,0x40,0x00,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}; // Woodblock
+const unsigned char ym_patch_116[78] PROGMEM = {0x22,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x40,0x02,0x60,0x40,0x00,0x78,0x40,0x20,0x00,0x18,0x00,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x06,0x00,0x40,0x00,0x78,0x00,0x78,0x00,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}; // Taiko Drum
+const unsigned char ym_patch_117[78] PROGMEM = {0x22,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x78,0x00,0x78,0x00,0x60,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x78,0x00,0x78,0x00,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}; // Melodic Tom
+const unsigned char ym_patch_118[78] PROGMEM = {0x22,0x00,0x00,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x60,0x00,0x00,0x00,0x00,0x40,0x78,0x68,0x00,0x60,0x00,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x78,0x00,0x78,0x00,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}; // Synth Drum
+const unsigned char ym_patch_119[78] PROGMEM = {0x22,0x00,0x00,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x40,0x00,0x00,0x00,0x00,0x78,0x78,0x28,0x00,0x10,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x60,0x00,0x00,0x00,0x00,0x08,0x00,0x78,0x00,0x70,0x40,0x00,0x70,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}; // Reverse Cymbal
+const unsigned char ym_patch_120[78] PROGMEM = {0x22,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x28,0x78,0x50,0x00,0x60,0x00,0x00,0x70,0x00,0x00,0x00,0x00,0x20,0x04,0x00,0x00,0x00,0x40,0x38,0x48,0x00,0x60,0x00,0x00,0x70,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}; // Guitar Fret Noise
+const unsigned char ym_patch_121[78] PROGMEM = {0x22,0x00,0x00,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x00,0x00,0x60,0x40,0x00,0x78,0x78,0x30,0x00,0x10,0x00,0x00,0x08,0x00,0x00,0x00,0x00,0x60,0x00,0x00,0x40,0x00,0x18,0x00,0x78,0x00,0x30,0x00,0x00,0x70,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}; // Breath Noise
+const unsigned char ym_patch_122[78] PROGMEM = {0x22,0x00,0x00,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x20,0x00,0x78,0x00,0x18,0x00,0x00,0x70,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0x08,0x00,0x78,0x00,0x18,0x40,0x00,0x70,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}; // Seashore
+const unsigned char ym_patch_123[78] PROGMEM = {0x22,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x2A,0x40,0x40,0x00,0x18,0x38,0x28,0x00,0x18,0x40,0x00,0x58,0x00,0x00,0x00,0x00,0x40,0x00,0x00,0x40,0x00,0x20,0x30,0x60,0x00,0x38,0x00,0x00,0x50,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}; // Bird Tweet
+const unsigned char ym_patch_124[78] PROGMEM = {0x22,0x00,0x00,0x00,0x00,0x00,0x60,0x00,0x00,0x00,0x60,0x00,0x60,0x00,0x40,0x78,0x78,0x58,0x00,0x20,0x40,0x00,0x58,0x00,0x00,0x00,0x00,0x00,0x02,0x00,0x00,0x40,0x78,0x08,0x68,0x00,0x50,0x40,0x40,0x50,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}; // Telephone Ring
+const unsigned char ym_patch_125[78] PROGMEM = {0x22,0x00,0x00,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x20,0x00,0x00,0x40,0x40,0x78,0x00,0x78,0x00,0x70,0x40,0x00,0x70,0x00,0x00,0x00,0x00,0x00,0x14,0x00,0x40,0x40,0x18,0x00,0x78,0x00,0x70,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}; // Helicopter
+const unsigned char ym_patch_126[78] PROGMEM = {0x22,0x00,0x00,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x78,0x00,0x78,0x00,0x18,0x00,0x00,0x70,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x40,0x08,0x00,0x78,0x00,0x18,0x40,0x40,0x70,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}; // Applause
+const unsigned char ym_patch_127[78] PROGMEM = {0x22,0x00,0x00,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x78,0x60,0x68,0x00,0x18,0x40,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x78,0x00,0x78,0x00,0x30,0x40,0x00,0x70,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}; // Gun Shot
+const unsigned char ym_patch_128[78] PROGMEM = {0x22,0x30,0x00,0x00,0x00,0x00,0x50,0x00,0x00,0x00,0x00,0x00,0x60,0x00,0x00,0x78,0x58,0x28,0x00,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x78,0x00,0x78,0x00,0x38,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}; // Acoustic Bass Drum
+const unsigned char ym_patch_129[78] PROGMEM = {0x22,0x30,0x00,0x00,0x00,0x00,0x50,0x00,0x00,0x00,0x00,0x00,0x60,0x00,0x00,0x78,0x58,0x28,0x00,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x78,0x00,0x78,0x00,0x38,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}; // Acoustic Bass Drum
+const unsigned char ym_patch_130[78] PROGMEM = {0x22,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x60,0x00,0x00,0x78,0x68,0x18,0x00,0x10,0x00,0x00,0x28,0x00,0x00,0x00,0x00,0x60,0x00,0x00,0x40,0x00,0x78,0x48,0x10,0x00,0x48,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}; // Slide Stick
+const unsigned char ym_patch_131[78] PROGMEM = {0x22,0x3C,0x00,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x40,0x78,0x60,0x00,0x50,0x00,0x00,0x70,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x50,0x40,0x48,0x00,0x38,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}; // Acoustic Snare
+const unsigned char ym_patch_132[78] PROGMEM = {0x22,0x3C,0x00,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x40,0x00,0x00,0x00,0x00,0x40,0x18,0x68,0x00,0x60,0x00,0x00,0x28,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x48,0x48,0x50,0x00,0x40,0x00,0x00,0x18,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}; // Hand Clap
+const unsigned char ym_patch_133[78] PROGMEM = {0x22,0x46,0x00,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x40,0x00,0x00,0x00,0x00,0x40,0x20,0x50,0x00,0x60,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x78,0x40,0x38,0x00,0x50,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}; // Electric Snare
+const unsigned char ym_patch_134[78] PROGMEM = {0x22,0x33,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x78,0x78,0x78,0x00,0x60,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x78,0x78,0x78,0x00,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}; // Low Floor Tom
+const unsigned char ym_patch_135[78] PROGMEM = {0x22,0x3C,0x00,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x00,0x00,0x60,0x00,0x00,0x78,0x00,0x78,0x00,0x20,0x40,0x00,0x08,0x00,0x00,0x00,0x00,0x60,0x00,0x00,0x00,0x00,0x78,0x00,0x78,0x00,0x40,0x00,0x00,0x48,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}; // Closed High-Hat
+const unsigned char ym_patch_136[78] PROGMEM = {0x22,0x36,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x78,0x78,0x78,0x00,0x60,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x78,0x78,0x78,0x00,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}; // High Floor Tom
+const unsigned char ym_patch_137[78] PROGMEM = {0x22,0x3C,0x00,0x00,0x00,0x00,0x60,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x78,0x00,0x78,0x00,0x30,0x00,0x00,0x08,0x00,0x00,0x00,0x00,0x60,0x00,0x00,0x00,0x00,0x40,0x40,0x60,0x00,0x48,0x00,0x00,0x68,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}; // Pedal High Hat
+const unsigned char ym_patch_138[78] PROGMEM = {0x22,0x38,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x78,0x78,0x78,0x00,0x60,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x78,0x78,0x78,0x00,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}; // Low Tom
+const unsigned char ym_patch_139[78] PROGMEM = {0x22,0x3C,0x00,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x20,0x00,0x60,0x00,0x00,0x78,0x10,0x68,0x00,0x78,0x00,0x00,0x08,0x00,0x00,0x00,0x00,0x60,0x00,0x00,0x00,0x00,0x78,0x28,0x50,0x00,0x30,0x40,0x00,0x70,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}; // Open High Hat
+const unsigned char ym_patch_140[78] PROGMEM = {0x22,0x3D,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x78,0x78,0x78,0x00,0x60,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x78,0x78,0x78,0x00,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}; // Low-Mid Tom
+const unsigned char ym_patch_141[78] PROGMEM = {0x22,0x3F,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x78,0x78,0x78,0x00,0x60,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x78,0x78,0x78,0x00,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}; // High-mid Tom
+const unsigned char ym_patch_142[78] PROGMEM = {0x22,0x30,0x00,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x20,0x00,0x60,0x00,0x00,0x78,0x10,0x68,0x00,0x78,0x40,0x00,0x08,0x00,0x00,0x00,0x00,0x60,0x00,0x00,0x00,0x00,0x78,0x28,0x50,0x00,0x30,0x40,0x00,0x70,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}; // Crash Cymbal 1
+const unsigned char ym_patch_143[78] PROGMEM = {0x22,0x44,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x78,0x78,0x78,0x00,0x60,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x78,0x78,0x78,0x00,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}; // High Tom
+const unsigned char ym_patch_144[78] PROGMEM = {0x22,0x3C,0x00,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x50,0x78,0x50,0x00,0x28,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x60,0x00,0x00,0x00,0x00,0x78,0x78,0x48,0x00,0x20,0x40,0x00,0x58,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}; // Ride Cymbal 1
+const unsigned char ym_patch_145[78] PROGMEM = {0x22,0x3C,0x00,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x20,0x00,0x60,0x00,0x00,0x30,0x20,0x58,0x00,0x48,0x00,0x00,0x08,0x00,0x00,0x00,0x00,0x60,0x00,0x00,0x00,0x00,0x78,0x28,0x50,0x00,0x30,0x40,0x00,0x50,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}; // Chinses Cymbal
+const unsigned char ym_patch_146[78] PROGMEM = {0x22,0x3C,0x00,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x50,0x78,0x50,0x00,0x28,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x60,0x00,0x00,0x00,0x00,0x78,0x78,0x48,0x00,0x20,0x40,0x00,0x58,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}; // Ride Bell
+const unsigned char ym_patch_147[78] PROGMEM = {0x22,0x42,0x00,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x40,0x00,0x00,0x00,0x00,0x40,0x48,0x48,0x00,0x38,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x60,0x00,0x00,0x00,0x00,0x40,0x38,0x50,0x00,0x38,0x40,0x00,0x70,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}; // Tambourine
+const unsigned char ym_patch_148[78] PROGMEM = {0x22,0x3C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x60,0x00,0x00,0x78,0x10,0x68,0x00,0x78,0x40,0x00,0x08,0x00,0x00,0x00,0x00,0x60,0x00,0x00,0x00,0x00,0x78,0x28,0x50,0x00,0x30,0x40,0x00,0x70,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}; // Splash Cymbal
+const unsigned char ym_patch_149[78] PROGMEM = {0x22,0x3B,0x00,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x20,0x00,0x60,0x00,0x00,0x78,0x70,0x50,0x00,0x10,0x00,0x00,0x48,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x78,0x00,0x78,0x00,0x40,0x00,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}; // Cowbell
+const unsigned char ym_patch_150[78] PROGMEM = {0x22,0x40,0x00,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x20,0x00,0x60,0x00,0x00,0x78,0x10,0x68,0x00,0x78,0x40,0x00,0x08,0x00,0x00,0x00,0x00,0x60,0x00,0x00,0x00,0x00,0x78,0x28,0x50,0x00,0x30,0x40,0x00,0x70,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}; // Crash Cymbal 2
+const unsigned char ym_patch_151[78] PROGMEM = {0x22,0x30,0x00,0x00,0x00,0x00,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0x78,0x10,0x50,0x00,0x78,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0x00,0x00,0x00,0x60,0x20,0x40,0x00,0x78,0x00,0x00,0x70,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}; // Vibraslap
+const unsigned char ym_patch_152[78] PROGMEM = {0x22,0x3C,0x00,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x50,0x78,0x50,0x00,0x28,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x60,0x00,0x00,0x00,0x00,0x78,0x78,0x48,0x00,0x20,0x40,0x00,0x58,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}; // Ride Cymbal 2
+const unsigned char ym_patch_153[78] PROGMEM = {0x22,0x38,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x60,0x00,0x00,0x78,0x00,0x78,0x00,0x60,0x00,0x00,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x78,0x40,0x60,0x00,0x50,0x00,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}; // High Bongo
+const unsigned char ym_patch_154[78] PROGMEM = {0x22,0x35,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x60,0x00,0x00,0x78,0x00,0x78,0x00,0x58,0x00,0x00,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x78,0x38,0x60,0x00,0x38,0x00,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}; // Low Bango
+const unsigned char ym_patch_155[78] PROGMEM = {0x22,0x41,0x00,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x00,0x00,0x60,0x00,0x00,0x78,0x00,0x78,0x00,0x60,0x00,0x00,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x78,0x68,0x70,0x00,0x50,0x00,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}; // Mute High Conga
+const unsigned char ym_patch_156[78] PROGMEM = {0x22,0x31,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x60,0x00,0x00,0x78,0x00,0x78,0x00,0x58,0x00,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x78,0x38,0x60,0x00,0x38,0x00,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}; // Open High Conga
+const unsigned char ym_patch_157[78] PROGMEM = {0x22,0x2B,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x60,0x00,0x00,0x78,0x00,0x78,0x00,0x58,0x00,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x78,0x38,0x60,0x00,0x38,0x00,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}; // Low Conga
+const unsigned char ym_patch_158[78] PROGMEM = {0x22,0x41,0x00,0x00,0x00,0x00,0x40,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x48,0x50,0x40,0x00,0x38,0x00,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x78,0x38,0x38,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}; // High Timbale
+const unsigned char ym_patch_159[78] PROGMEM = {0x22,0x3C,0x00,0x00,0x00,0x00,0x40,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x48,0x50,0x40,0x00,0x38,0x00,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x78,0x38,0x38,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}; // Low Timbale
+const unsigned char ym_patch_160[78] PROGMEM = {0x22,0x46,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x60,0x00,0x60,0x00,0x40,0x78,0x78,0x68,0x00,0x28,0x00,0x00,0x28,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0x78,0x00,0x38,0x00,0x00,0x18,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}; // High Agogo
+const unsigned char ym_patch_161[78] PROGMEM = {0x22,0x41,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x60,0x00,0x60,0x00,0x40,0x78,0x78,0x68,0x00,0x28,0x00,0x00,0x28,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0x78,0x00,0x38,0x00,0x00,0x18,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}; // Low Agogo
+const unsigned char ym_patch_162[78] PROGMEM = {0x22,0x3C,0x00,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x00,0x00,0x60,0x40,0x00,0x48,0x00,0x78,0x00,0x40,0x00,0x00,0x08,0x00,0x00,0x00,0x00,0x60,0x00,0x00,0x00,0x00,0x40,0x48,0x50,0x00,0x38,0x40,0x00,0x70,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}; // Cabasa
+const unsigned char ym_patch_163[78] PROGMEM = {0x22,0x3C,0x00,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x78,0x08,0x70,0x00,0x58,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x60,0x00,0x00,0x40,0x00,0x40,0x58,0x58,0x00,0x30,0x40,0x00,0x70,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}; // Maracas
+const unsigned char ym_patch_164[78] PROGMEM = {0x22,0x38,0x00,0x00,0x00,0x00,0x50,0x00,0x00,0x00,0x40,0x00,0x40,0x00,0x00,0x28,0x00,0x78,0x00,0x28,0x00,0x40,0x60,0x00,0x00,0x00,0x00,0x00,0x14,0x00,0x40,0x00,0x40,0x28,0x50,0x00,0x60,0x40,0x00,0x68,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}; // Short Whistle
+const unsigned char ym_patch_165[78] PROGMEM = {0x22,0x35,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0x20,0x00,0x00,0x28,0x00,0x78,0x00,0x28,0x40,0x00,0x60,0x00,0x00,0x00,0x00,0x00,0x14,0x00,0x00,0x00,0x40,0x28,0x50,0x00,0x60,0x00,0x40,0x68,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}; // Long Whistle
+const unsigned char ym_patch_166[78] PROGMEM = {0x22,0x3C,0x00,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x40,0x00,0x00,0x00,0x00,0x78,0x00,0x78,0x00,0x30,0x40,0x00,0x58,0x00,0x00,0x00,0x00,0x60,0x00,0x00,0x40,0x00,0x78,0x30,0x58,0x00,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}; // Short Guiro
+const unsigned char ym_patch_167[78] PROGMEM = {0x22,0x30,0x00,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x60,0x00,0x00,0x00,0x00,0x78,0x38,0x30,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0x00,0x40,0x00,0x20,0x38,0x28,0x00,0x78,0x40,0x00,0x70,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}; // Long Guiro
+const unsigned char ym_patch_168[78] PROGMEM = {0x22,0x45,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0x00,0x60,0x00,0x00,0x40,0x00,0x78,0x00,0x78,0x00,0x78,0x00,0x00,0x68,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0x78,0x38,0x00,0x00,0x00,0x00,0x00,0x28,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}; // Claves
+const unsigned char ym_patch_169[78] PROGMEM = {0x22,0x43,0x00,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x00,0x00,0x60,0x00,0x00,0x78,0x68,0x28,0x00,0x18,0x00,0x00,0x38,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x78,0x48,0x40,0x00,0x40,0x00,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}; // High Wood Block
+const unsigned char ym_patch_170[78] PROGMEM = {0x22,0x3E,0x00,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x00,0x00,0x60,0x00,0x00,0x78,0x68,0x28,0x00,0x18,0x00,0x00,0x38,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x78,0x48,0x40,0x00,0x40,0x00,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}; // Low Wood Block
+const unsigned char ym_patch_171[78] PROGMEM = {0x22,0x41,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0E,0x40,0x00,0x00,0x18,0x20,0x08,0x00,0x58,0x00,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x28,0x00,0x78,0x00,0x38,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}; // Mute Cuica
+const unsigned char ym_patch_172[78] PROGMEM = {0x22,0x3C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x16,0x60,0x00,0x00,0x18,0x18,0x08,0x00,0x78,0x00,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x28,0x00,0x78,0x00,0x38,0x00,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}; // Open Cuica
+const unsigned char ym_patch_173[78] PROGMEM = {0x22,0x3F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0x40,0x00,0x00,0x78,0x78,0x20,0x00,0x10,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x40,0x08,0x00,0x40,0x00,0x40,0x38,0x70,0x00,0x40,0x00,0x00,0x48,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}; // Mute Triangle
+const unsigned char ym_patch_174[78] PROGMEM = {0x22,0x3F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0x40,0x00,0x00,0x78,0x78,0x40,0x00,0x78,0x00,0x00,0x30,0x00,0x00,0x00,0x00,0x40,0x14,0x00,0x00,0x00,0x78,0x00,0x78,0x00,0x20,0x00,0x00,0x48,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}; // Open Triangle
+const unsigned char ym_bank[] PROGMEM = {
+0x00,0x22,0x00,0x0A,0x21,0xCF,0xF0,0x04,0x01,0x01,0x00,0xF4,0xD6,0x00, // 0: Acoustic Grand Piano
+0x00,0x22,0x00,0x00,0x21,0xC7,0xF0,0x04,0x01,0x01,0x00,0xF4,0xD6,0x00, // 1: Bright Acoustic Piano
+0x00,0x22,0x00,0x0A,0x21,0x1B,0xF0,0x04,0x00,0x01,0x00,0xF4,0xD6,0x00, // 2: Electric Grand Piano
+0x00,0x22,0x00,0x04,0xA1,0xCE,0xF0,0x04,0x01,0x81,0x00,0xF4,0xD6,0x01, // 3: Honky-tonk Piano
+0x00,0x22,0x00,0x08,0x01,0x12,0xF3,0x65,0x00,0x11,0x00,0xF1,0x7D,0x00, // 4: Electric Piano 1
+0x00,0x22,0x00,0x00,0x68,0xE8,0xF5,0x54,0x02,0x21,0x00,0xF3,0xB7,0x00, // 5: Electric Piano 2
+0x00,0x22,0x00,0x0A,0x01,0xC6,0xF1,0x4F,0x01,0x11,0x06,0xF3,0xD6,0x03, // 6: Harpsichord
+0x00,0x22,0x00,0x0E,0x03,0x58,0xF3,0xAD,0x00,0x01,0x00,0x83,0x5E,0x01, // 7: Clavi
+0x00,0x22,0x00,0x0E,0x28,0xD4,0x4C,0x1F,0x00,0x01,0x00,0xF6,0x45,0x00, // 8: Celesta
+0x00,0x22,0x00,0x00,0x08,0x92,0xF2,0x23,0x02,0x14,0x00,0xF4,0x73,0x00, // 9: Glockenspiel
+0x00,0x22,0x00,0x00,0x16,0x64,0x62,0x2F,0x02,0x01,0x01,0xF4,0x6A,0x00, // 10: Music Box
+0x00,0x22,0x00,0x03,0x06,0x10,0xF5,0x36,0x00,0x61,0x00,0xFD,0x25,0x00, // 11: Vibraphone
+0x00,0x22,0x00,0x04,0x0A,0xD5,0x6D,0x17,0x00,0x01,0x00,0xF0,0x05,0x00, // 12: Marimba
+0x00,0x22,0x00,0x0C,0x12,0xC8,0xF8,0x65,0x02,0x01,0x00,0xF6,0xD7,0x00, // 13: Xylophone
+0x00,0x22,0x00,0x0E,0x83,0x00,0xFF,0x92,0x00,0x15,0x00,0xF0,0x03,0x00, // 14: Tubular Bells
+0x00,0x22,0x00,0x00,0x03,0xC0,0x8B,0x38,0x00,0x00,0x00,0x83,0x39,0x02, // 15: Dulcimer
+0x00,0x22,0x00,0x0D,0xA0,0xC0,0xF0,0x0F,0x00,0xA2,0x06,0xF0,0x0F,0x00, // 16: Hammond Organ
+0x00,0x22,0x00,0x0F,0x24,0x00,0xFF,0x9F,0x02,0x21,0x00,0xF0,0x0F,0x01, // 17: Percussive Organ
+0x00,0x22,0x00,0x07,0x30,0x00,0xFF,0x1F,0x01,0x32,0x00,0x5E,0x4C,0x01, // 18: Rock Organ
+0x00,0x22,0x00,0x01,0x24,0x12,0xF0,0x0B,0x01,0x30,0x00,0x50,0x0B,0x02, // 19: Church Organ
+0x00,0x22,0x00,0x0F,0x24,0x49,0xF0,0x0B,0x01,0x30,0x00,0x50,0x0B,0x02, // 20: Reed Organ
+0x00,0x22,0x00,0x0A,0x24,0xCC,0xF0,0x0B,0x00,0x31,0x0A,0x50,0x0B,0x01, // 21: Accordion
+0x00,0x22,0x00,0x00,0x24,0xCA,0x6F,0x2F,0x01,0x30,0x0A,0x40,0x0D,0x02, // 22: Harmonica
+0x00,0x22,0x00,0x00,0x22,0xCD,0xF0,0x0B,0x00,0xB1,0x03,0x50,0x0B,0x01, // 23: Tango Accordion
+0x00,0x22,0x00,0x00,0x03,0xCE,0xF0,0x05,0x01,0x11,0x00,0xF2,0xC8,0x01, // 24: Guitar Nylon
+0x00,0x22,0x00,0x00,0x03,0x49,0xFF,0x25,0x01,0x11,0x00,0xF2,0xC8,0x01, // 25: Guitar Steel
+0x00,0x22,0x00,0x0E,0x03,0xD3,0xF5,0x45,0x01,0x21,0x00,0xF6,0x3A,0x00, // 26: Electric Guitar (jazz)
+0x00,0x22,0x00,0x0E,0x03,0x90,0x9E,0x26,0x01,0x21,0x00,0xF2,0xBB,0x00, // 27: Electric Guitar (clean)
+0x00,0x22,0x00,0x0E,0x01,0xC0,0xFF,0x47,0x00,0x00,0x00,0xF4,0xBC,0x02, // 28: Electric Guitar (muted))
+0x00,0x22,0x00,0x00,0x20,0xE0,0x6F,0x4F,0x00,0x20,0x01,0xFF,0x1F,0x03, // 29: Overdriven Guitar
+0x00,0x22,0x00,0x00,0x30,0xE0,0x5F,0x2F,0x03,0x30,0x01,0xFE,0x1F,0x03, // 30: Distortion Guitar
+0x00,0x22,0x00,0x0C,0x00,0x42,0x86,0x59,0x03,0x44,0x00,0x72,0x2A,0x00, // 31: Guitar Harmonics
+0x00,0x22,0x00,0x06,0x10,0x00,0xFE,0x54,0x00,0x30,0x00,0xF0,0x0F,0x00, // 32: Acoustic Bass
+0x00,0x22,0x00,0x08,0x30,0xC2,0x75,0x39,0x00,0x20,0x00,0xF2,0x88,0x00, // 33: Electric Bass (finger)
+0x00,0x22,0x00,0x0C,0x10,0x0A,0xFF,0x25,0x01,0x30,0x00,0xF0,0x06,0x00, // 34: Electric Bass (pick)
+0x00,0x22,0x00,0x08,0x30,0x0F,0xF3,0x39,0x00,0x60,0x00,0xF0,0x0C,0x00, // 35: Fretless Bass
+0x00,0x22,0x00,0x0E,0x20,0x18,0xF4,0x7F,0x00,0x21,0x00,0xF0,0x0F,0x00, // 36: Slap Bass 1
+0x00,0x22,0x00,0x06,0x10,0x00,0xF0,0x06,0x01,0x30,0x00,0xF0,0x06,0x00, // 37: Slap Bass 2
+0x00,0x22,0x00,0x0E,0x20,0x16,0xF6,0x5F,0x00,0x21,0x00,0xF0,0x0F,0x00, // 38: Synth Bass 1
+0x00,0x22,0x00,0x04,0x10,0x08,0xF0,0x06,0x00,0x30,0x00,0xF0,0x06,0x00, // 39: Synth Bass 2
+0x00,0x22,0x00,0x0A,0x31,0x85,0x8D,0x37,0x01,0x71,0x00,0x38,0x16,0x00, // 40: Violin
+0x00,0x22,0x00,0x00,0x31,0xC5,0xF0,0x06,0x01,0x71,0x00,0x50,0x06,0x01, // 41: Viola
+0x00,0x22,0x00,0x00,0x31,0x40,0xF4,0x1F,0x01,0x61,0x00,0x53,0x36,0x01, // 42: Cello
+0x00,0x22,0x00,0x00,0x31,0xC0,0xF4,0x1F,0x00,0x61,0x00,0x63,0x36,0x01, // 43: Contrabass
+0x00,0x22,0x00,0x0E,0xB1,0x1D,0xF2,0x43,0x00,0xA1,0x00,0x51,0x28,0x01, // 44: Tremolo Strings
+0x00,0x22,0x00,0x00,0x02,0xD2,0xA7,0x79,0x02,0x10,0x00,0xF4,0x84,0x02, // 45: Pizzicato Strings
+0x00,0x22,0x00,0x0A,0x22,0x1B,0xF6,0x94,0x01,0x31,0x00,0xF2,0x9B,0x00, // 46: Orchestral Harp
+0x00,0x22,0x00,0x00,0x01,0x40,0xF8,0x26,0x01,0x00,0x00,0xF0,0x05,0x01, // 47: Timpani
+0x00,0x22,0x00,0x0E,0x31,0x1D,0xF2,0x43,0x00,0x21,0x00,0x51,0x28,0x01, // 48: String Ensembles 1
+0x00,0x22,0x00,0x0E,0x31,0x56,0x10,0x01,0x01,0x30,0x00,0x20,0x04,0x02, // 49: String Ensembles 2
+0x00,0x22,0x00,0x0E,0x31,0x1B,0xF1,0x36,0x01,0x21,0x00,0x61,0x28,0x00, // 50: Synth Strings 1
+0x00,0x22,0x00,0x0E,0x31,0x1C,0xF1,0x34,0x00,0x21,0x00,0x51,0x28,0x00, // 51: Synth Strings 2
+0x00,0x22,0x00,0x00,0x31,0x5B,0xF4,0x15,0x00,0xB2,0x03,0x60,0x05,0x00, // 52: Choir Aahs
+0x00,0x22,0x00,0x00,0xE1,0x46,0xFC,0x72,0x01,0x71,0x00,0x62,0x17,0x00, // 53: Voice Oohs
+0x00,0x22,0x00,0x0C,0xB1,0x57,0x30,0x05,0x00,0xB2,0x00,0x50,0x05,0x00, // 54: Synth Voice
+0x00,0x22,0x00,0x06,0x00,0x00,0xF6,0x62,0x00,0x01,0x08,0xF3,0x1B,0x00, // 55: Orchestra Hit
+0x00,0x22,0x00,0x0A,0x71,0x14,0x53,0x65,0x00,0x21,0x00,0xF0,0x0F,0x00, // 56: Trumpet
+0x00,0x22,0x00,0x0E,0x31,0x56,0x42,0x25,0x00,0x61,0x01,0xF0,0x0F,0x00, // 57: Trombone
+0x00,0x22,0x00,0x0E,0x21,0x55,0x52,0x25,0x01,0x61,0x01,0x93,0x29,0x00, // 58: Tuba
+0x00,0x22,0x00,0x0E,0x71,0x20,0x54,0x75,0x00,0x21,0x00,0x90,0x08,0x00, // 59: Muted Trumpet
+0x00,0x22,0x00,0x0A,0x21,0x18,0x51,0x26,0x00,0x21,0x00,0xF0,0x07,0x00, // 60: French Horn
+0x00,0x22,0x00,0x0E,0x21,0x1B,0x54,0x37,0x00,0x21,0x00,0xF0,0x08,0x00, // 61: Brass Section
+0x00,0x22,0x00,0x0E,0x21,0x16,0x65,0x39,0x01,0x21,0x00,0xF2,0x9E,0x00, // 62: Synth Brass 1
+0x00,0x22,0x00,0x0E,0x21,0x1E,0x56,0x37,0x00,0x21,0x00,0xF0,0x0A,0x00, // 63: Synth Bass 2
+0x00,0x22,0x00,0x06,0x21,0x4E,0x60,0x04,0x00,0x31,0x00,0x50,0x09,0x01, // 64: Soprano Sax
+0x00,0x22,0x00,0x0A,0x21,0x8E,0x60,0x04,0x00,0x31,0x00,0x50,0x09,0x01, // 65: Alto Sax
+0x00,0x22,0x00,0x0A,0x21,0x8E,0x50,0x05,0x00,0x21,0x00,0x50,0x09,0x01, // 66: Tenor Sax
+0x00,0x22,0x00,0x0A,0x31,0x8E,0x50,0x05,0x00,0x21,0x00,0x50,0x09,0x01, // 67: Baritone Sax
+0x00,0x22,0x00,0x00,0x31,0x17,0x80,0x03,0x00,0x32,0x00,0xF1,0x36,0x01, // 68: Oboe
+0x00,0x22,0x00,0x00,0x20,0x19,0x60,0x06,0x02,0x22,0x00,0x70,0x0A,0x01, // 69: English Horn
+0x00,0x22,0x00,0x00,0x20,0x1E,0x50,0x06,0x01,0x22,0x00,0x60,0x0A,0x00, // 70: Bassoon
+0x00,0x22,0x00,0x0C,0x32,0x4C,0x8C,0x25,0x00,0x21,0x00,0x62,0x17,0x00, // 71: Clarinet
+0x00,0x22,0x00,0x0C,0x71,0x57,0x30,0x04,0x00,0x21,0x00,0x50,0x0A,0x00, // 72: Piccolo
+0x00,0x22,0x00,0x0C,0x71,0x55,0x51,0x44,0x00,0x21,0x00,0x50,0x0A,0x00, // 73: Flute
+0x00,0x22,0x00,0x00,0x32,0xDF,0x40,0x0F,0x02,0x21,0x00,0x50,0x09,0x00, // 74: Recorder
+0x00,0x22,0x00,0x0E,0x11,0x20,0x46,0x9C,0x03,0x21,0x00,0x63,0x5A,0x00, // 75: Pan Flute
+0x00,0x22,0x00,0x0E,0x31,0x17,0x75,0x9D,0x03,0x21,0x00,0x50,0x09,0x00, // 76: Bottle Blow
+0x00,0x22,0x00,0x0E,0x02,0x00,0xF8,0x5A,0x03,0x71,0x00,0x42,0x2A,0x00, // 77: Shakuhachi
+0x00,0x22,0x00,0x0E,0xE0,0xEC,0x4E,0x8F,0x00,0xA1,0x00,0x55,0x2A,0x00, // 78: Whistle
+0x00,0x22,0x00,0x00,0x32,0xDF,0x40,0x0F,0x00,0x21,0x00,0x70,0x09,0x00, // 79: Ocarina
+0x00,0x22,0x00,0x0E,0x22,0x5D,0xF0,0x0F,0x02,0x21,0x00,0xF0,0x0F,0x00, // 80: Lead 1 (Square)
+0x00,0x22,0x00,0x0C,0x31,0x0F,0x52,0x53,0x00,0x21,0x00,0xF2,0x47,0x01, // 81: Lead 2 (sawtooth)
+0x00,0x22,0x00,0x0E,0x71,0x17,0x65,0x9D,0x03,0x21,0x00,0x50,0x09,0x00, // 82: Lead 3 (calliope)
+0x00,0x22,0x00,0x0E,0x02,0x00,0xF8,0x5A,0x00,0x70,0x00,0x42,0x2A,0x02, // 83: Lead 4 (chiffer)
+0x00,0x22,0x00,0x00,0x21,0xC0,0xF4,0x57,0x00,0x32,0x00,0xF2,0x28,0x02, // 84: Lead 5 (charang)
+0x00,0x22,0x00,0x00,0xA1,0xC6,0x65,0x9D,0x02,0x21,0x00,0x50,0x09,0x02, // 85: Lead 6 (voice)
+0x00,0x22,0x00,0x0B,0x23,0xC0,0xF4,0x58,0x03,0x22,0x10,0x64,0x48,0x03, // 86: Lead 7 (5th sawtooth)
+0x00,0x22,0x00,0x08,0x31,0xCB,0xF3,0xED,0x00,0x31,0x00,0xF1,0x7D,0x00, // 87: Lead 8 (bass+Lead)
+0x00,0x22,0x00,0x00,0x09,0xC0,0xFF,0x95,0x03,0xE1,0x00,0x52,0x25,0x00, // 88: Pad 1 (New Age)
+0x00,0x22,0x00,0x00,0x31,0x58,0x20,0x05,0x00,0x31,0x00,0x30,0x06,0x00, // 89: Pad 2 (warm)
+0x00,0x22,0x00,0x0A,0x21,0x0E,0x54,0x73,0x00,0x21,0x07,0xF0,0x08,0x00, // 90: Pad 3 (polysynth)
+0x00,0x22,0x00,0x00,0xB1,0x5D,0x30,0x03,0x00,0xB2,0x00,0x40,0x04,0x00, // 91: Pad 4 (choir)
+0x00,0x22,0x00,0x0E,0x34,0x27,0x30,0x02,0x02,0x21,0x09,0xF0,0x03,0x00, // 92: Pad 5 (bowed glass)
+0x00,0x22,0x00,0x00,0x01,0x63,0x20,0x04,0x03,0x30,0x00,0x20,0x04,0x02, // 93: Pad 6 (metal)
+0x00,0x22,0x00,0x06,0x01,0x99,0x52,0x58,0x00,0xA1,0x00,0x41,0x36,0x00, // 94: Pad 7 (Halo)
+0x00,0x22,0x00,0x0C,0x31,0x1B,0x11,0x26,0x00,0x31,0x00,0x10,0x07,0x00, // 95: Pad 8 (sweep)
+0x00,0x22,0x00,0x00,0x91,0xD0,0xF2,0xB4,0x00,0x01,0x00,0xF1,0x75,0x00, // 96: FX 1 (rain)
+0x00,0x22,0x00,0x09,0x32,0x06,0x21,0x57,0x00,0x63,0x00,0x42,0x19,0x00, // 97: FX2 (soundtrack)
+0x00,0x22,0x00,0x0E,0x85,0x15,0x9F,0x85,0x03,0x11,0x00,0xF3,0x43,0x00, // 98: FX 3 (crystal)
+0x00,0x22,0x00,0x0A,0x03,0xD7,0xF4,0x15,0x01,0x21,0x00,0xF2,0xC8,0x00, // 99: FX 4 (atmosphere)
+0x00,0x22,0x00,0x00,0x00,0x11,0xF3,0x95,0x02,0xA0,0x00,0xF2,0xB9,0x02, // 100: FX 5 (brightness)
+0x00,0x22,0x00,0x00,0x21,0xCF,0x00,0x05,0x00,0x20,0x00,0x10,0x04,0x02, // 101: FX 6 (goblin)
+0x00,0x22,0x00,0x00,0x00,0x1B,0xF4,0xA3,0x02,0xA0,0x00,0xF2,0xB9,0x02, // 102: FX 7 (echo drops)
+0x00,0x22,0x00,0x0E,0x12,0x22,0x43,0x64,0x00,0x30,0x00,0x80,0x02,0x02, // 103: FX 8 (star-theme)
+0x00,0x22,0x00,0x00,0x01,0x40,0xF2,0x98,0x00,0x07,0x09,0xF3,0xD5,0x01, // 104: Sitar
+0x00,0x22,0x00,0x0E,0x00,0x00,0xFF,0x83,0x00,0x02,0x00,0xF5,0x66,0x01, // 105: Banjo
+0x00,0x22,0x00,0x0E,0x12,0x80,0xFF,0x75,0x02,0x10,0x00,0xF3,0xE8,0x02, // 106: Shamisen
+0x00,0x22,0x00,0x00,0x02,0x0F,0xF4,0x63,0x01,0x02,0x00,0xF5,0x64,0x01, // 107: Koto
+0x00,0x22,0x00,0x00,0x05,0xC9,0xFB,0x64,0x00,0x00,0x00,0x96,0x57,0x02, // 108: Kalimba
+0x00,0x22,0x00,0x0E,0x13,0x0C,0xFF,0xB2,0x01,0x30,0x0A,0x50,0x0F,0x03, // 109: Bag Pipe
+0x00,0x22,0x00,0x0A,0x30,0x0E,0xF2,0x1D,0x02,0x21,0x00,0x40,0x0C,0x01, // 110: Fiddle
+0x00,0x22,0x00,0x00,0x30,0xC0,0x30,0x02,0x03,0x30,0x00,0x40,0x06,0x02, // 111: Shanai
+0x00,0x22,0x00,0x00,0x25,0xC0,0xFF,0x75,0x03,0x03,0x00,0xFE,0x33,0x00, // 112: Tinkle Bell
+0x00,0x22,0x00,0x00,0x25,0xC0,0xFE,0x7D,0x03,0x03,0x00,0x90,0x07,0x00, // 113: Agogo
+0x00,0x22,0x00,0x00,0x07,0xDC,0x40,0x03,0x00,0x01,0x00,0x60,0x05,0x00, // 114: Steel Drums
+0x00,0x22,0x00,0x0E,0x07,0xC0,0xFD,0xA3,0x00,0x02,0x00,0xF9,0x78,0x00, // 115: Woodblock
+0x00,0x22,0x00,0x04,0x11,0xC1,0xF8,0xB3,0x02,0x10,0x03,0xF0,0x03,0x00, // 116: Taiko Drum
+0x00,0x22,0x00,0x04,0x00,0x00,0xF0,0x0C,0x00,0x00,0x00,0xF0,0x06,0x00, // 117: Melodic Tom
+0x00,0x22,0x00,0x0E,0x01,0x00,0x8F,0x2C,0x03,0x00,0x00,0xF0,0x06,0x00, // 118: Synth Drum
+0x00,0x22,0x00,0x0E,0x80,0x00,0xFF,0xA2,0x02,0x8E,0x00,0x10,0x0E,0x03, // 119: Reverse Cymbal
+0x00,0x22,0x00,0x00,0x0E,0x00,0x5F,0x5C,0x00,0x0E,0x02,0x87,0x6C,0x01, // 120: Guitar Fret Noise
+0x00,0x22,0x00,0x0E,0x11,0xC0,0xFF,0x92,0x00,0x1E,0x00,0x30,0x06,0x03, // 121: Breath Noise
+0x00,0x22,0x00,0x0E,0x2E,0x00,0x40,0x03,0x00,0x9E,0x00,0x10,0x03,0x00, // 122: Seashore
+0x00,0x22,0x00,0x00,0x9B,0x95,0x37,0xA3,0x02,0x1A,0x00,0x46,0x37,0x02, // 123: Bird Tweet
+0x00,0x22,0x00,0x0C,0xAB,0xC0,0xFF,0x44,0x03,0xEA,0x01,0xF1,0x2A,0x00, // 124: Telephone Ring
+0x00,0x22,0x00,0x0E,0xBE,0x00,0xF0,0x0E,0x01,0x30,0x0A,0x30,0x0E,0x00, // 125: Helicopter
+0x00,0x22,0x00,0x0E,0x2E,0x00,0xF0,0x03,0x00,0xFE,0x00,0x10,0x03,0x00, // 126: Applause
+0x00,0x22,0x00,0x0E,0xC0,0x00,0xFC,0x23,0x00,0x8E,0x00,0xF0,0x06,0x00, // 127: Gun Shot
+0x00,0x22,0x30,0x0A,0x00,0xC0,0xFB,0xA3,0x00,0x00,0x00,0xF0,0x07,0x00, // 128: Acoustic Bass Drum
+0x00,0x22,0x30,0x0A,0x00,0xC0,0xFB,0xA3,0x00,0x00,0x00,0xF0,0x07,0x00, // 129: Acoustic Bass Drum
+0x00,0x22,0x30,0x00,0x05,0xC0,0xFD,0xC2,0x00,0x10,0x00,0xF9,0xD9,0x03, // 130: Slide Stick
+0x00,0x22,0x3C,0x0E,0x2E,0x00,0x8F,0x3A,0x00,0x00,0x00,0xA8,0x67,0x00, // 131: Acoustic Snare
+0x00,0x22,0x3C,0x0E,0x05,0x00,0x83,0x2C,0x02,0x03,0x00,0x99,0x58,0x00, // 132: Hand Clap
+0x00,0x22,0x46,0x0E,0x00,0x00,0x84,0x5C,0x02,0x00,0x00,0xF8,0x8A,0x00, // 133: Electric Snare
+0x00,0x22,0x33,0x04,0x00,0x00,0xFF,0x0C,0x00,0x00,0x00,0xFF,0x06,0x00, // 134: Low Floor Tom
+0x00,0x22,0x3C,0x0E,0x81,0xC0,0xF0,0x04,0x00,0x09,0x00,0xF0,0x08,0x03, // 135: Closed High-Hat
+0x00,0x22,0x36,0x04,0x00,0x00,0xFF,0x0C,0x00,0x00,0x00,0xFF,0x06,0x00, // 136: High Floor Tom
+0x00,0x22,0x3C,0x0C,0x01,0x40,0xF0,0x06,0x00,0x0D,0x00,0x88,0x39,0x03, // 137: Pedal High Hat
+0x00,0x22,0x38,0x04,0x00,0x00,0xFF,0x0C,0x00,0x00,0x00,0xFF,0x06,0x00, // 138: Low Tom
+0x00,0x22,0x3C,0x0E,0x01,0xC0,0xF2,0x2F,0x01,0x8E,0x00,0xF5,0x56,0x03, // 139: Open High Hat
+0x00,0x22,0x3D,0x04,0x00,0x00,0xFF,0x0C,0x00,0x00,0x00,0xFF,0x06,0x00, // 140: Low-Mid Tom
+0x00,0x22,0x3F,0x04,0x00,0x00,0xFF,0x0C,0x00,0x00,0x00,0xFF,0x06,0x00, // 141: High-mid Tom
+0x00,0x22,0x30,0x0E,0x81,0xC0,0xF2,0x2F,0x01,0x8E,0x00,0xF5,0x56,0x03, // 142: Crash Cymbal 1
+0x00,0x22,0x44,0x04,0x00,0x00,0xFF,0x0C,0x00,0x00,0x00,0xFF,0x06,0x00, // 143: High Tom
+0x00,0x22,0x3C,0x0E,0x00,0x00,0xAF,0x55,0x01,0x8B,0x00,0xFF,0x64,0x03, // 144: Ride Cymbal 1
+0x00,0x22,0x3C,0x0E,0x01,0xC0,0x64,0x49,0x01,0x8A,0x00,0xF5,0x56,0x03, // 145: Chinses Cymbal
+0x00,0x22,0x3C,0x0E,0x00,0x00,0xAF,0x55,0x01,0x8B,0x00,0xFF,0x64,0x03, // 146: Ride Bell
+0x00,0x22,0x42,0x0E,0x00,0x00,0x89,0x67,0x02,0x8E,0x00,0x87,0x57,0x03, // 147: Tambourine
+0x00,0x22,0x3C,0x00,0x81,0xC0,0xF2,0x2F,0x00,0x8E,0x00,0xF5,0x56,0x03, // 148: Splash Cymbal
+0x00,0x22,0x3B,0x0E,0x09,0xC0,0xFE,0x52,0x01,0x02,0x00,0xF0,0x08,0x00, // 149: Cowbell
+0x00,0x22,0x40,0x0E,0x81,0xC0,0xF2,0x2F,0x01,0x8E,0x00,0xF5,0x56,0x03, // 150: Crash Cymbal 2
+0x00,0x22,0x30,0x06,0x10,0x00,0xF2,0x5F,0x00,0x0E,0x00,0xC4,0x7F,0x02, // 151: Vibraslap
+0x00,0x22,0x3C,0x0E,0x00,0x00,0xAF,0x55,0x01,0x8B,0x00,0xFF,0x64,0x03, // 152: Ride Cymbal 2
+0x00,0x22,0x38,0x00,0x03,0xC0,0xF0,0x0C,0x00,0x02,0x00,0xF8,0x3A,0x00, // 153: High Bongo
+0x00,0x22,0x35,0x00,0x03,0xC0,0xF0,0x0B,0x00,0x02,0x00,0xF7,0x37,0x00, // 154: Low Bango
+0x00,0x22,0x41,0x0E,0x03,0xC0,0xF0,0x0C,0x00,0x02,0x00,0xFD,0x1A,0x00, // 155: Mute High Conga
+0x00,0x22,0x31,0x00,0x02,0xC0,0xF0,0x0B,0x00,0x02,0x00,0xF7,0x37,0x00, // 156: Open High Conga
+0x00,0x22,0x2B,0x00,0x02,0xC0,0xF0,0x0B,0x00,0x02,0x00,0xF7,0x37,0x00, // 157: Low Conga
+0x00,0x22,0x41,0x08,0x01,0x00,0x9A,0x77,0x01,0x00,0x00,0xF7,0x84,0x00, // 158: High Timbale
+0x00,0x22,0x3C,0x08,0x01,0x00,0x9A,0x77,0x01,0x00,0x00,0xF7,0x84,0x00, // 159: Low Timbale
+0x00,0x22,0x46,0x00,0x25,0xC0,0xFF,0x25,0x03,0x03,0x00,0x80,0x07,0x00, // 160: High Agogo
+0x00,0x22,0x41,0x00,0x25,0xC0,0xFF,0x25,0x03,0x03,0x00,0x80,0x07,0x00, // 161: Low Agogo
+0x00,0x22,0x3C,0x0E,0x11,0xC0,0x90,0x08,0x00,0x8E,0x00,0x89,0x57,0x03, // 162: Cabasa
+0x00,0x22,0x3C,0x0E,0x00,0x00,0xF1,0x1B,0x01,0x9E,0x00,0x8B,0x46,0x03, // 163: Maracas
+0x00,0x22,0x38,0x0A,0x4C,0x80,0x50,0x05,0x02,0x9D,0x0A,0x85,0x5C,0x00, // 164: Short Whistle
+0x00,0x22,0x35,0x00,0x8C,0x40,0x50,0x05,0x02,0x4D,0x0A,0x85,0x5C,0x00, // 165: Long Whistle
+0x00,0x22,0x3C,0x0E,0x8B,0x00,0xF0,0x06,0x02,0x10,0x00,0xF6,0x46,0x03, // 166: Short Guiro
+0x00,0x22,0x30,0x0E,0x00,0x00,0xF7,0x92,0x03,0x9E,0x00,0x47,0xAF,0x02, // 167: Long Guiro
+0x00,0x22,0x45,0x01,0x1D,0x00,0xF0,0x0F,0x03,0x15,0x00,0xF7,0xF0,0x00, // 168: Claves
+0x00,0x22,0x43,0x0E,0x07,0xC0,0xFD,0xA3,0x00,0x02,0x00,0xF9,0x78,0x00, // 169: High Wood Block
+0x00,0x22,0x3E,0x0E,0x07,0xC0,0xFD,0xA3,0x00,0x02,0x00,0xF9,0x78,0x00, // 170: Low Wood Block
+0x00,0x22,0x41,0x00,0x02,0x87,0x34,0xEB,0x00,0x04,0x00,0x50,0x07,0x00, // 171: Mute Cuica
+0x00,0x22,0x3C,0x00,0x01,0xCB,0x33,0xEF,0x00,0x02,0x00,0x50,0x07,0x00, // 172: Open Cuica
+0x00,0x22,0x3F,0x00,0x04,0x80,0xFF,0xB2,0x02,0x19,0x04,0x87,0x18,0x02, // 173: Mute Triangle
+0x00,0x22,0x3F,0x00,0x06,0x80,0xFF,0x7F,0x02,0x09,0x0A,0xF0,0x04,0x02, // 174: Open Triangle
+};
+const uint16_t ym_bank_index[] PROGMEM = {0,14,28,42,56,70,84,98,112,126,140,154,168,182,196,210,224,238,252,266,280,294,308,322,336,350,364,378,392,406,420,434,448,462,476,490,504,518,532,546,560,574,588,602,616,630,644,658,672,686,700,714,728,742,756,770,784,798,812,826,840,854,868,882,896,910,924,938,952,966,980,994,1008,1022,1036,1050,1064,1078,1092,1106,1120,1134,1148,1162,1176,1190,1204,1218,1232,1246,1260,1274,1288,1302,1316,1330,1344,1358,1372,1386,1400,1414,1428,1442,1456,1470,1484,1498,1512,1526,1540,1554,1568,1582,1596,1610,1624,1638,1652,1666,1680,1694,1708,1722,1736,1750,1764,1778,1792,1806,1820,1834,1848,1862,1876,1890,1904,1918,1932,1946,1960,1974,1988,2002,2016,2030,2044,2058,2072,2086,2100,2114,2128,2142,2156,2170,2184,2198,2212,2226,2240,2254,2268,2282,2296,2310,2324,2338,2352,2366,2380,2394,2408,2422,2436,};
 const unsigned char *patches[] = {
 ym_patch_0,ym_patch_1,ym_patch_2,ym_patch_3,ym_patch_4,ym_patch_5,ym_patch_6,ym_patch_7,ym_patch_8,ym_patch_9,ym_patch_10,ym_patch_11,ym_patch_12,ym_patch_13,ym_patch_14,ym_patch_15,ym_patch_16,ym_patch_17,ym_patch_18,ym_patch_19,ym_patch_20,ym_patch_21,ym_patch_22,ym_patch_23,ym_patch_24,ym_patch_25,ym_patch_26,ym_patch_27,ym_patch_28,ym_patch_29,ym_patch_30,ym_patch_31,ym_patch_32,ym_patch_33,ym_patch_34,ym_patch_35,ym_patch_36,ym_patch_37,ym_patch_38,ym_patch_39,ym_patch_40,ym_patch_41,ym_patch_42,ym_patch_43,ym_patch_44,ym_patch_45,ym_patch_46,ym_patch_47,ym_patch_48,ym_patch_49,ym_patch_50,ym_patch_51,ym_patch_52,ym_patch_53,ym_patch_54,ym_patch_55,ym_patch_56,ym_patch_57,ym_patch_58,ym_patch_59,ym_patch_60,ym_patch_61,ym_patch_62,ym_patch_63,ym_patch_64,ym_patch_65,ym_patch_66,ym_patch_67,ym_patch_68,ym_patch_69,ym_patch_70,ym_patch_71,ym_patch_72,ym_patch_73,ym_patch_74,ym_patch_75,ym_patch_76,ym_patch_77,ym_patch_78,ym_patch_79,ym_patch_80,ym_patch_81,ym_patch_82,ym_patch_83,ym_patch_84,ym_patch_85,ym_patch_86,ym_patch_87,ym_patch_88,ym_patch_89,ym_patch_90,ym_patch_91,ym_patch_92,ym_patch_93,ym_patch_94,ym_patch_95,ym_patch_96,ym_patch_97,ym_patch_98,ym_patch_99,ym_patch_100,ym_patch_101,ym_patch_102,ym_patch_103,ym_patch_104,ym_patch_105,ym_patch_106,ym_patch_107,ym_patch_108,ym_patch_109,ym_patch_110,ym_patch_111,ym_patch_112,ym_patch_113,ym_patch_114,ym_patch_115,ym_patch_116,ym_patch_117,ym_patch_118,ym_patch_119,ym_patch_120,ym_patch_121,ym_patch_122,ym_patch_123,ym_patch_124,ym_patch_125,ym_patch_126,ym_patch_127,ym_patch_128,ym_patch_129,ym_patch_130,ym_patch_131,ym_patch_132,ym_patch_133,ym_patch_134,ym_patch_135,ym_patch_136,ym_patch_137,ym_patch_138,ym_patch_139,ym_patch_140,ym_patch_141,ym_patch_142,ym_patch_143,ym_patch_144,ym_patch_145,ym_patch_146,ym_patch_147,ym_patch_148,ym_patch_149,ym_patch_150,ym_patch_151,ym_patch_152,ym_patch_153,ym_patch_154,ym_patch_155,ym_patch_156,ym_patch_157,ym_patch_158,ym_patch_159,ym_patch_160,ym_patch_161,ym_patch_162,ym_patch_163,ym_patch_164,ym_patch_165,ym_patch_166,ym_patch_167,ym_patch_168,ym_patch_169,ym_patch_170,ym_patch_171,ym_patch_172,ym_patch_173,ym_patch_174,};
 const char PName0[] PROGMEM = "Acoustic Grand Piano";
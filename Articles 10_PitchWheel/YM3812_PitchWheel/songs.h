@@ -0,0 +1,23 @@
+#ifndef SONGS_H
+#define SONGS_H
+
+// Songs for SmfPlayer, stored as Standard MIDI Files in program memory.
+
+const unsigned char demo_song[330] PROGMEM = { // Two bars of piano, bass and drums (type 1, 4 tracks, 120 BPM)
+  0x4D,0x54,0x68,0x64,0x00,0x00,0x00,0x06,0x00,0x01,0x00,0x04,0x00,0x60,0x4D,0x54,0x72,0x6B,0x00,0x00,0x00,0x0B,0x00,0xFF,
+  0x51,0x03,0x07,0xA1,0x20,0x00,0xFF,0x2F,0x00,0x4D,0x54,0x72,0x6B,0x00,0x00,0x00,0x65,0x00,0x90,0x3C,0x64,0x2C,0x3C,0x00,
+  0x04,0x40,0x64,0x2C,0x40,0x00,0x04,0x43,0x64,0x2C,0x43,0x00,0x04,0x48,0x64,0x2C,0x48,0x00,0x04,0x47,0x64,0x2C,0x47,0x00,
+  0x04,0x43,0x64,0x2C,0x43,0x00,0x04,0x40,0x64,0x2C,0x40,0x00,0x04,0x3E,0x64,0x2C,0x3E,0x00,0x04,0x3C,0x64,0x2C,0x3C,0x00,
+  0x04,0x40,0x64,0x2C,0x40,0x00,0x04,0x43,0x64,0x2C,0x43,0x00,0x04,0x48,0x64,0x2C,0x48,0x00,0x04,0x4A,0x64,0x2C,0x4A,0x00,
+  0x04,0x48,0x64,0x2C,0x48,0x00,0x04,0x43,0x64,0x2C,0x43,0x00,0x04,0x3C,0x64,0x2C,0x3C,0x00,0x00,0xFF,0x2F,0x00,0x4D,0x54,
+  0x72,0x6B,0x00,0x00,0x00,0x47,0x00,0xC1,0x21,0x00,0x91,0x24,0x6E,0x58,0x81,0x24,0x40,0x08,0x91,0x24,0x6E,0x58,0x81,0x24,
+  0x40,0x08,0x91,0x2B,0x6E,0x58,0x81,0x2B,0x40,0x08,0x91,0x2B,0x6E,0x58,0x81,0x2B,0x40,0x08,0x91,0x29,0x6E,0x58,0x81,0x29,
+  0x40,0x08,0x91,0x29,0x6E,0x58,0x81,0x29,0x40,0x08,0x91,0x2B,0x6E,0x58,0x81,0x2B,0x40,0x08,0x91,0x2B,0x6E,0x58,0x81,0x2B,
+  0x40,0x00,0xFF,0x2F,0x00,0x4D,0x54,0x72,0x6B,0x00,0x00,0x00,0x65,0x00,0x99,0x24,0x6E,0x18,0x24,0x00,0x18,0x2A,0x6E,0x18,
+  0x2A,0x00,0x18,0x26,0x6E,0x18,0x26,0x00,0x18,0x2A,0x6E,0x18,0x2A,0x00,0x18,0x24,0x6E,0x18,0x24,0x00,0x18,0x2A,0x6E,0x18,
+  0x2A,0x00,0x18,0x26,0x6E,0x18,0x26,0x00,0x18,0x2A,0x6E,0x18,0x2A,0x00,0x18,0x24,0x6E,0x18,0x24,0x00,0x18,0x2A,0x6E,0x18,
+  0x2A,0x00,0x18,0x26,0x6E,0x18,0x26,0x00,0x18,0x2A,0x6E,0x18,0x2A,0x00,0x18,0x24,0x6E,0x18,0x24,0x00,0x18,0x2A,0x6E,0x18,
+  0x2A,0x00,0x18,0x26,0x6E,0x18,0x26,0x00,0x18,0x2A,0x6E,0x18,0x2A,0x00,0x00,0xFF,0x2F,0x00
+};
+
+#endif
@@ -92,6 +92,53 @@ function toHex( v ){
   return( val )
 }
 
+// Packed Bank Format
+// The generic patch format holds 78 bytes, most of which the YM3812 never looks at. The packed format keeps only
+// what the chip uses, already composed into register values (see YMDefs.h for the matching firmware definitions):
+//   Byte 0      Flags - bit 0: second voice present, bit 1: virtual settings present
+//   Byte 1      PATCH_PROC_CONF
+//   Byte 2      PATCH_NOTE_NUMBER
+//   Bytes 3-13  Voice 1: 0xC0, then 0x20, 0x40, 0x60, 0x80, 0xE0 for operator 1 followed by operator 2
+//   +12 bytes   Voice 2 (only if flag bit 0): same 11 register bytes, then PATCH_DETUNE_FINE of operator 3
+//   +6 bytes    Virtual (only if flag bit 1): PEG init, attack, release, release level, tremolo & vibrato sens
+const PACKED_FLAG_VOICE2    = 0b01
+const PACKED_FLAG_VIRTUAL   = 0b10
+
+function packVoice( gen, firstOp ){
+  let bytes = [ ((gen[PATCH_FEEDBACK]>>4)<<1) | (gen[PATCH_ALGORITHM]>>6) ];   // 0xC0: Feedback and algorithm
+  for( let op = firstOp; op < firstOp+2; op++ ){
+    let o = PATCH_OP_SETTINGS * op;                                            // Operator offset within the patch
+    bytes.push( ((gen[o+PATCH_TREMOLO]>>6)<<7) | ((gen[o+PATCH_VIBRATO]>>6)<<6) |        // 0x20
+                ((gen[o+PATCH_PERCUSSIVE_ENV]>>6)<<5) | ((gen[o+PATCH_ENV_SCALING]>>6)<<4) |
+                 (gen[o+PATCH_FREQUENCY_MULT]>>3) );
+    bytes.push( ((gen[o+PATCH_LEVEL_SCALING]>>5)<<6) | (gen[o+PATCH_LEVEL]>>1) );         // 0x40
+    bytes.push( ((gen[o+PATCH_ATTACK]>>3)<<4) | (gen[o+PATCH_DECAY]>>3) );                // 0x60
+    bytes.push( ((0xF-(gen[o+PATCH_SUSTAIN_LEVEL]>>3))<<4) | (gen[o+PATCH_RELEASE_RATE]>>3) ); // 0x80
+    bytes.push( gen[o+PATCH_WAVEFORM]>>5 );                                                // 0xE0
+  }
+  return( bytes );
+}
+
+function packPatch( gen ){
+  let flags = 0;
+  let bytes = [ gen[PATCH_PROC_CONF], gen[PATCH_NOTE_NUMBER] ].concat( packVoice( gen, 0 ) );
+
+  if( (gen[PATCH_PROC_CONF] & 0x0F) == CONF_2x2OP ){                           // Second voice only when the patch plays it
+    flags |= PACKED_FLAG_VOICE2;
+    bytes = bytes.concat( packVoice( gen, 2 ) );
+    bytes.push( gen[PATCH_OP_SETTINGS * 2 + PATCH_DETUNE_FINE] );
+  }
+
+  let virt = [ gen[PATCH_PEG_INIT_LEVEL], gen[PATCH_PEG_ATTACK], gen[PATCH_PEG_RELEASE],
+               gen[PATCH_PEG_REL_LEVEL], gen[PATCH_TREMOLO_SENS], gen[PATCH_VIBRATO_SENS] ];
+  if( virt.some( v => v != 0 ) ){                                              // Virtual settings only when something is set
+    flags |= PACKED_FLAG_VIRTUAL;
+    bytes = bytes.concat( virt );
+  }
+
+  return( [ flags ].concat( bytes ) );
+}
+
 function processOP2File( fileName, data ){
   let fileData = new binStream( FS.readFileSync( `./${fileName}`) );
 
@@ -149,103 +196,117 @@ function processOP2File( fileName, data ){
 
   let firstDrum = 128; //Can't have more than 128 patches, so this has to be highest patch
 
+  let packed = [];
   outStr = "#ifndef INSTRUMENTS_H\n#define INSTRUMENTS_H\n";
   patchList.map( (patch, inst) => {
+    let gen = [];
+
     // Voice level
-    outStr += `const unsigned char ym_patch_${inst}[${PATCH_SIZE}] PROGMEM = {`;
     if( patch.flags & 0b100 ){
-    	outStr += `0x${toHex( PROC_YM3812 | CONF_2x2OP ) },`;                  // PATCH_PROC_CONF (Dual 2OP Voice YM3812)
+    	gen.push( PROC_YM3812 | CONF_2x2OP );                                  // PATCH_PROC_CONF (Dual 2OP Voice YM3812)
 	} else {
-    	outStr += `0x${toHex( PROC_YM3812 | CONF_2OP ) },`;                    // PATCH_PROC_CONF (Single 2OP Voice YM3812)
+    	gen.push( PROC_YM3812 | CONF_2OP );                                    // PATCH_PROC_CONF (Single 2OP Voice YM3812)
 	}
-    outStr += `0x${toHex( ((patch.noteNum         >> 0) & 0b01111111 )<<0)},`; // PATCH_NOTE_NUMBER
-    outStr += "0x00,";                                                         // PATCH_PEG_INIT_LEVEL
-    outStr += "0x00,";                                                         // PATCH_PEG_ATTACK
-    outStr += "0x00,";                                                         // PATCH_PEG_RELEASE
-    outStr += "0x00,";                                                         // PATCH_PEG_REL_LEVEL
-    outStr += `0x${toHex( ((patch.v1_feedback >> 1) & 0b111 )<<4)},`;          // PATCH_FEEDBACK
-    outStr += `0x${toHex( ((patch.v1_feedback >> 0) & 0b1   )<<6)},`;          // PATCH_ALGORITHM
-    outStr += "0x00,";                                                         // PATCH_TREMOLO_SENS
-    outStr += "0x00,";                                                         // PATCH_VIBRATO_SENS
+    gen.push( ((patch.noteNum         >> 0) & 0b01111111 )<<0);                // PATCH_NOTE_NUMBER
+    gen.push( 0x00 );                                                          // PATCH_PEG_INIT_LEVEL
+    gen.push( 0x00 );                                                          // PATCH_PEG_ATTACK
+    gen.push( 0x00 );                                                          // PATCH_PEG_RELEASE
+    gen.push( 0x00 );                                                          // PATCH_PEG_REL_LEVEL
+    gen.push( ((patch.v1_feedback >> 1) & 0b111 )<<4);                         // PATCH_FEEDBACK
+    gen.push( ((patch.v1_feedback >> 0) & 0b1   )<<6);                         // PATCH_ALGORITHM
+    gen.push( 0x00 );                                                          // PATCH_TREMOLO_SENS
+    gen.push( 0x00 );                                                          // PATCH_VIBRATO_SENS
 
     // Operator Level
-    outStr += `0x${toHex( ((patch.v1_op1_waveform >> 0) & 0b00000011 )<<5)},`; // PATCH_WAVEFORM
-    outStr += `0x${toHex( ((patch.v1_op1_level    >> 0) & 0b00111111 )<<1)},`; // PATCH_LEVEL
-    outStr += `0x${toHex( ((patch.v1_op1_lvlScale >> 6) & 0b00000011 )<<5)},`; // PATCH_LEVEL_SCALING
-    outStr += `0x${toHex( ((patch.v1_op1_adr_20   >> 4) & 0b00000001 )<<6)},`; // PATCH_ENV_SCALING
-    outStr += `0x${toHex( ((patch.v1_op1_adr_20   >> 5) & 0b00000001 )<<6)},`; // PATCH_PERCUSSIVE_ENV
-    outStr += `0x${toHex( ((patch.v1_op1_adr_60   >> 4) & 0b00001111 )<<3)},`; // PATCH_ATTACK
-    outStr += `0x${toHex( ((patch.v1_op1_adr_60   >> 0) & 0b00001111 )<<3)},`; // PATCH_DECAY
-    outStr += `0x${toHex( ((0xF-(patch.v1_op1_adr_80   >> 4)) & 0b00001111 )<<3)},`; // PATCH_SUSTAIN_LEVEL
-    outStr += "0x00,";                                                         // PATCH_SUSTAIN_DECAY
-    outStr += `0x${toHex( ((patch.v1_op1_adr_80   >> 0) & 0b00001111 )<<3)},`; // PATCH_RELEASE_RATE
-    outStr += `0x${toHex( ((patch.v1_op1_adr_20   >> 7) & 0b00000001 )<<6)},`; // PATCH_TREMOLO
-    outStr += `0x${toHex( ((patch.v1_op1_adr_20   >> 6) & 0b00000001 )<<6)},`; // PATCH_VIBRATO
-    outStr += `0x${toHex( ((patch.v1_op1_adr_20   >> 0) & 0b00001111 )<<3)},`; // PATCH_FREQUENCY_MULT
-    outStr += `0x00,`;                                                         // PATCH_DETUNE_FINE
-    outStr += "0x00,";                                                         // PATCH_DETUNE_GROSS
-    outStr += "0x00,";                                                         // PATCH_SSGENV_ENABLE
-    outStr += "0x00,";                                                         // PATCH_SSGENV_WAVEFORM
+    gen.push( ((patch.v1_op1_waveform >> 0) & 0b00000011 )<<5);                // PATCH_WAVEFORM
+    gen.push( ((patch.v1_op1_level    >> 0) & 0b00111111 )<<1);                // PATCH_LEVEL
+    gen.push( ((patch.v1_op1_lvlScale >> 6) & 0b00000011 )<<5);                // PATCH_LEVEL_SCALING
+    gen.push( ((patch.v1_op1_adr_20   >> 4) & 0b00000001 )<<6);                // PATCH_ENV_SCALING
+    gen.push( ((patch.v1_op1_adr_20   >> 5) & 0b00000001 )<<6);                // PATCH_PERCUSSIVE_ENV
+    gen.push( ((patch.v1_op1_adr_60   >> 4) & 0b00001111 )<<3);                // PATCH_ATTACK
+    gen.push( ((patch.v1_op1_adr_60   >> 0) & 0b00001111 )<<3);                // PATCH_DECAY
+    gen.push( ((0xF-(patch.v1_op1_adr_80   >> 4)) & 0b00001111 )<<3);          // PATCH_SUSTAIN_LEVEL
+    gen.push( 0x00 );                                                          // PATCH_SUSTAIN_DECAY
+    gen.push( ((patch.v1_op1_adr_80   >> 0) & 0b00001111 )<<3);                // PATCH_RELEASE_RATE
+    gen.push( ((patch.v1_op1_adr_20   >> 7) & 0b00000001 )<<6);                // PATCH_TREMOLO
+    gen.push( ((patch.v1_op1_adr_20   >> 6) & 0b00000001 )<<6);                // PATCH_VIBRATO
+    gen.push( ((patch.v1_op1_adr_20   >> 0) & 0b00001111 )<<3);                // PATCH_FREQUENCY_MULT
+    gen.push( 0x00 );                                                          // PATCH_DETUNE_FINE
+    gen.push( 0x00 );                                                          // PATCH_DETUNE_GROSS
+    gen.push( 0x00 );                                                          // PATCH_SSGENV_ENABLE
+    gen.push( 0x00 );                                                          // PATCH_SSGENV_WAVEFORM
 
     // Operator Level (OP2)
-    outStr += `0x${toHex( ((patch.v1_op2_waveform >> 0) & 0b00000011 )<<5)},`; // PATCH_WAVEFORM
-    outStr += `0x${toHex( ((patch.v1_op2_level    >> 0) & 0b00111111 )<<1)},`; // PATCH_LEVEL
-    outStr += `0x${toHex( ((patch.v1_op2_lvlScale >> 6) & 0b00000011 )<<5)},`; // PATCH_LEVEL_SCALING
-    outStr += `0x${toHex( ((patch.v1_op2_adr_20   >> 4) & 0b00000001 )<<6)},`; // PATCH_ENV_SCALING
-    outStr += `0x${toHex( ((patch.v1_op2_adr_20   >> 5) & 0b00000001 )<<6)},`; // PATCH_PERCUSSIVE_ENV
-    outStr += `0x${toHex( ((patch.v1_op2_adr_60   >> 4) & 0b00001111 )<<3)},`; // PATCH_ATTACK
-    outStr += `0x${toHex( ((patch.v1_op2_adr_60   >> 0) & 0b00001111 )<<3)},`; // PATCH_DECAY
-    outStr += `0x${toHex( ((0xF-(patch.v1_op2_adr_80   >> 4)) & 0b00001111 )<<3)},`; // PATCH_SUSTAIN_LEVEL
-    outStr += "0x00,";                                                         // PATCH_SUSTAIN_DECAY
-    outStr += `0x${toHex( ((patch.v1_op2_adr_80   >> 0) & 0b00001111 )<<3)},`; // PATCH_RELEASE_RATE
-    outStr += `0x${toHex( ((patch.v1_op2_adr_20   >> 7) & 0b00000001 )<<6)},`; // PATCH_TREMOLO
-    outStr += `0x${toHex( ((patch.v1_op2_adr_20   >> 6) & 0b00000001 )<<6)},`; // PATCH_VIBRATO
-    outStr += `0x${toHex( ((patch.v1_op2_adr_20   >> 0) & 0b00001111 )<<3)},`; // PATCH_FREQUENCY_MULT
-    outStr += `0x00,`;                                                         // PATCH_DETUNE_FINE
-    outStr += "0x00,";                                                         // PATCH_DETUNE_GROSS
-    outStr += "0x00,";                                                         // PATCH_SSGENV_ENABLE
-    outStr += "0x00,";                                                         // PATCH_SSGENV_WAVEFORM
+    gen.push( ((patch.v1_op2_waveform >> 0) & 0b00000011 )<<5);                // PATCH_WAVEFORM
+    gen.push( ((patch.v1_op2_level    >> 0) & 0b00111111 )<<1);                // PATCH_LEVEL
+    gen.push( ((patch.v1_op2_lvlScale >> 6) & 0b00000011 )<<5);                // PATCH_LEVEL_SCALING
+    gen.push( ((patch.v1_op2_adr_20   >> 4) & 0b00000001 )<<6);                // PATCH_ENV_SCALING
+    gen.push( ((patch.v1_op2_adr_20   >> 5) & 0b00000001 )<<6);                // PATCH_PERCUSSIVE_ENV
+    gen.push( ((patch.v1_op2_adr_60   >> 4) & 0b00001111 )<<3);                // PATCH_ATTACK
+    gen.push( ((patch.v1_op2_adr_60   >> 0) & 0b00001111 )<<3);                // PATCH_DECAY
+    gen.push( ((0xF-(patch.v1_op2_adr_80   >> 4)) & 0b00001111 )<<3);          // PATCH_SUSTAIN_LEVEL
+    gen.push( 0x00 );                                                          // PATCH_SUSTAIN_DECAY
+    gen.push( ((patch.v1_op2_adr_80   >> 0) & 0b00001111 )<<3);                // PATCH_RELEASE_RATE
+    gen.push( ((patch.v1_op2_adr_20   >> 7) & 0b00000001 )<<6);                // PATCH_TREMOLO
+    gen.push( ((patch.v1_op2_adr_20   >> 6) & 0b00000001 )<<6);                // PATCH_VIBRATO
+    gen.push( ((patch.v1_op2_adr_20   >> 0) & 0b00001111 )<<3);                // PATCH_FREQUENCY_MULT
+    gen.push( 0x00 );                                                          // PATCH_DETUNE_FINE
+    gen.push( 0x00 );                                                          // PATCH_DETUNE_GROSS
+    gen.push( 0x00 );                                                          // PATCH_SSGENV_ENABLE
+    gen.push( 0x00 );                                                          // PATCH_SSGENV_WAVEFORM
 
     // Operator Level Voice 2
-    outStr += `0x${toHex( ((patch.v2_op1_waveform >> 0) & 0b00000011 )<<5)},`; // PATCH_WAVEFORM
-    outStr += `0x${toHex( ((patch.v2_op1_level    >> 0) & 0b00111111 )<<1)},`; // PATCH_LEVEL
-    outStr += `0x${toHex( ((patch.v2_op1_lvlScale >> 6) & 0b00000011 )<<5)},`; // PATCH_LEVEL_SCALING
-    outStr += `0x${toHex( ((patch.v2_op1_adr_20   >> 4) & 0b00000001 )<<6)},`; // PATCH_ENV_SCALING
-    outStr += `0x${toHex( ((patch.v2_op1_adr_20   >> 5) & 0b00000001 )<<6)},`; // PATCH_PERCUSSIVE_ENV
-    outStr += `0x${toHex( ((patch.v2_op1_adr_60   >> 4) & 0b00001111 )<<3)},`; // PATCH_ATTACK
-    outStr += `0x${toHex( ((patch.v2_op1_adr_60   >> 0) & 0b00001111 )<<3)},`; // PATCH_DECAY
-    outStr += `0x${toHex( ((0xF-(patch.v2_op1_adr_80   >> 4)) & 0b00001111 )<<3)},`; // PATCH_SUSTAIN_LEVEL
-    outStr += "0x00,";                                                         // PATCH_SUSTAIN_DECAY
-    outStr += `0x${toHex( ((patch.v2_op1_adr_80   >> 0) & 0b00001111 )<<3)},`; // PATCH_RELEASE_RATE
-    outStr += `0x${toHex( ((patch.v2_op1_adr_20   >> 7) & 0b00000001 )<<6)},`; // PATCH_TREMOLO
-    outStr += `0x${toHex( ((patch.v2_op1_adr_20   >> 6) & 0b00000001 )<<6)},`; // PATCH_VIBRATO
-    outStr += `0x${toHex( ((patch.v2_op1_adr_20   >> 0) & 0b00001111 )<<3)},`; // PATCH_FREQUENCY_MULT
-    outStr += `0x${toHex( ((patch.fineTune        >> 0) & 0b00001111 )<<3)},`; // PATCH_DETUNE_FINE
-    outStr += "0x00,";                                                         // PATCH_DETUNE_GROSS
-    outStr += "0x00,";                                                         // PATCH_SSGENV_ENABLE
-    outStr += "0x00,";                                                         // PATCH_SSGENV_WAVEFORM
+    gen.push( ((patch.v2_op1_waveform >> 0) & 0b00000011 )<<5);                // PATCH_WAVEFORM
+    gen.push( ((patch.v2_op1_level    >> 0) & 0b00111111 )<<1);                // PATCH_LEVEL
+    gen.push( ((patch.v2_op1_lvlScale >> 6) & 0b00000011 )<<5);                // PATCH_LEVEL_SCALING
+    gen.push( ((patch.v2_op1_adr_20   >> 4) & 0b00000001 )<<6);                // PATCH_ENV_SCALING
+    gen.push( ((patch.v2_op1_adr_20   >> 5) & 0b00000001 )<<6);                // PATCH_PERCUSSIVE_ENV
+    gen.push( ((patch.v2_op1_adr_60   >> 4) & 0b00001111 )<<3);                // PATCH_ATTACK
+    gen.push( ((patch.v2_op1_adr_60   >> 0) & 0b00001111 )<<3);                // PATCH_DECAY
+    gen.push( ((0xF-(patch.v2_op1_adr_80   >> 4)) & 0b00001111 )<<3);          // PATCH_SUSTAIN_LEVEL
+    gen.push( 0x00 );                                                          // PATCH_SUSTAIN_DECAY
+    gen.push( ((patch.v2_op1_adr_80   >> 0) & 0b00001111 )<<3);                // PATCH_RELEASE_RATE
+    gen.push( ((patch.v2_op1_adr_20   >> 7) & 0b00000001 )<<6);                // PATCH_TREMOLO
+    gen.push( ((patch.v2_op1_adr_20   >> 6) & 0b00000001 )<<6);                // PATCH_VIBRATO
+    gen.push( ((patch.v2_op1_adr_20   >> 0) & 0b00001111 )<<3);                // PATCH_FREQUENCY_MULT
+    gen.push( ((patch.fineTune        >> 1) & 0b01111111 )<<0);                // PATCH_DETUNE_FINE (64 = in tune, 1/32 semitone steps)
+    gen.push( 0x00 );                                                          // PATCH_DETUNE_GROSS
+    gen.push( 0x00 );                                                          // PATCH_SSGENV_ENABLE
+    gen.push( 0x00 );                                                          // PATCH_SSGENV_WAVEFORM
 
     // Operator Level (OP2) Voice 2
-    outStr += `0x${toHex( ((patch.v2_op2_waveform >> 0) & 0b00000011 )<<5)},`; // PATCH_WAVEFORM
-    outStr += `0x${toHex( ((patch.v2_op2_level    >> 0) & 0b00111111 )<<1)},`; // PATCH_LEVEL
-    outStr += `0x${toHex( ((patch.v2_op2_lvlScale >> 6) & 0b00000011 )<<5)},`; // PATCH_LEVEL_SCALING
-    outStr += `0x${toHex( ((patch.v2_op2_adr_20   >> 4) & 0b00000001 )<<6)},`; // PATCH_ENV_SCALING
-    outStr += `0x${toHex( ((patch.v2_op2_adr_20   >> 5) & 0b00000001 )<<6)},`; // PATCH_PERCUSSIVE_ENV
-    outStr += `0x${toHex( ((patch.v2_op2_adr_60   >> 4) & 0b00001111 )<<3)},`; // PATCH_ATTACK
-    outStr += `0x${toHex( ((patch.v2_op2_adr_60   >> 0) & 0b00001111 )<<3)},`; // PATCH_DECAY
-    outStr += `0x${toHex( ((0xF-(patch.v2_op2_adr_80   >> 4)) & 0b00001111 )<<3)},`; // PATCH_SUSTAIN_LEVEL
-    outStr += "0x00,";                                                         // PATCH_SUSTAIN_DECAY
-    outStr += `0x${toHex( ((patch.v2_op2_adr_80   >> 0) & 0b00001111 )<<3)},`; // PATCH_RELEASE_RATE
-    outStr += `0x${toHex( ((patch.v2_op2_adr_20   >> 7) & 0b00000001 )<<6)},`; // PATCH_TREMOLO
-    outStr += `0x${toHex( ((patch.v2_op2_adr_20   >> 6) & 0b00000001 )<<6)},`; // PATCH_VIBRATO
-    outStr += `0x${toHex( ((patch.v2_op2_adr_20   >> 0) & 0b00001111 )<<3)},`; // PATCH_FREQUENCY_MULT
-    outStr += `0x00,`;                                                         // PATCH_DETUNE_FINE
-    outStr += "0x00,";                                                         // PATCH_DETUNE_GROSS
-    outStr += "0x00,";                                                         // PATCH_SSGENV_ENABLE
-    outStr += "0x00";                                                          // PATCH_SSGENV_WAVEFORM
-    outStr += `}; // ${patch.name}\n`;
+    gen.push( ((patch.v2_op2_waveform >> 0) & 0b00000011 )<<5);                // PATCH_WAVEFORM
+    gen.push( ((patch.v2_op2_level    >> 0) & 0b00111111 )<<1);                // PATCH_LEVEL
+    gen.push( ((patch.v2_op2_lvlScale >> 6) & 0b00000011 )<<5);                // PATCH_LEVEL_SCALING
+    gen.push( ((patch.v2_op2_adr_20   >> 4) & 0b00000001 )<<6);                // PATCH_ENV_SCALING
+    gen.push( ((patch.v2_op2_adr_20   >> 5) & 0b00000001 )<<6);                // PATCH_PERCUSSIVE_ENV
+    gen.push( ((patch.v2_op2_adr_60   >> 4) & 0b00001111 )<<3);                // PATCH_ATTACK
+    gen.push( ((patch.v2_op2_adr_60   >> 0) & 0b00001111 )<<3);                // PATCH_DECAY
+    gen.push( ((0xF-(patch.v2_op2_adr_80   >> 4)) & 0b00001111 )<<3);          // PATCH_SUSTAIN_LEVEL
+    gen.push( 0x00 );                                                          // PATCH_SUSTAIN_DECAY
+    gen.push( ((patch.v2_op2_adr_80   >> 0) & 0b00001111 )<<3);                // PATCH_RELEASE_RATE
+    gen.push( ((patch.v2_op2_adr_20   >> 7) & 0b00000001 )<<6);                // PATCH_TREMOLO
+    gen.push( ((patch.v2_op2_adr_20   >> 6) & 0b00000001 )<<6);                // PATCH_VIBRATO
+    gen.push( ((patch.v2_op2_adr_20   >> 0) & 0b00001111 )<<3);                // PATCH_FREQUENCY_MULT
+    gen.push( 0x00 );                                                          // PATCH_DETUNE_FINE
+    gen.push( 0x00 );                                                          // PATCH_DETUNE_GROSS
+    gen.push( 0x00 );                                                          // PATCH_SSGENV_ENABLE
+    gen.push( 0x00 );                                                          // PATCH_SSGENV_WAVEFORM
+    outStr += `const unsigned char ym_patch_${inst}[${PATCH_SIZE}] PROGMEM = {${gen.map( v => "0x"+toHex(v) ).join(",")}}; // ${patch.name}\n`;
+    packed.push( packPatch( gen ) );
+  });
 
+  // Packed bank: the same patches squeezed down to the registers the YM3812 actually uses (see packPatch)
+  outStr += "const unsigned char ym_bank[] PROGMEM = {\n";
+  packed.map( (bytes, inst) => {
+    outStr += `${bytes.map( v => "0x"+toHex(v) ).join(",")}, // ${inst}: ${patchList[inst].name}\n`;
   });
+  outStr += "};\n";
+
+  let offset = 0;
+  outStr += "const uint16_t ym_bank_index[] PROGMEM = {";
+  packed.map( (bytes) => { outStr += `${offset},`; offset += bytes.length; } );
+  outStr += "};\n";
 
   outStr += "const unsigned char *patches[] = {\n";
   patchList.map( (patch, inst) => {